@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ---------------- Host benchmark helpers ----------------
+// Each benchmark is a plain function registered in bench_main.cpp.
+// Results go to stdout as "key: value" lines so runs can be diffed.
+
+typedef int (*bench_fn)(int argc, char** argv);
+
+uint64_t bench_now_ns();
+int bench_arg_int(int argc, char** argv, int idx, int def);
+
+// Collects samples and prints count/mean/p50/p99/max
+class BenchSamples {
+public:
+    void reserve(size_t n) { v_.reserve(n); }
+    void add(double x) { v_.push_back(x); }
+    size_t count() const { return v_.size(); }
+    double mean() const;
+    double percentile(double p);
+    double max();
+    void print(const char* name, const char* unit);
+
+private:
+    std::vector<double> v_;
+    bool sorted_ = false;
+};
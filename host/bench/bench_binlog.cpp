@@ -0,0 +1,72 @@
+#include "bench.h"
+#include "log/binlog.h"
+#include <cstdio>
+#include <cstring>
+
+// Cost per hot-path log call: the old Serial.printf text vs BLOG into the
+// binary ring, and bytes each puts on the console. With a file argument
+// the drained stream (records mixed with a text line, as on the device)
+// is written there for tools/binlog_decode.py.
+// Usage: binlog [records] [capture.bin]
+
+class FileSink : public Print {
+public:
+    explicit FileSink(FILE* f) : f_(f) {}
+    int availableForWrite() override { return 64; }     // USB CDC-sized chunks
+    size_t write(const uint8_t* buf, size_t len) override
+    {
+        bytes += len;
+        return f_ ? fwrite(buf, 1, len, f_) : len;
+    }
+    uint64_t bytes = 0;
+
+private:
+    FILE* f_;
+};
+
+int bench_binlog(int argc, char** argv)
+{
+    int n = bench_arg_int(argc, argv, 0, 100000);
+    FILE* capture = argc > 1 ? fopen(argv[1], "wb") : nullptr;
+
+    // Text: what helix_volume_delta used to print per detent
+    char line[64];
+    uint64_t text_bytes = 0;
+    int64_t t0 = bench_now_ns();
+    for (int i = 0; i < n; i++) {
+        int idx = i % 121;
+        text_bytes += snprintf(line, sizeof(line), "[VOL] idx=%d  db=%.1f\n",
+                               idx, (idx - 60) * 0.5f);
+    }
+    int64_t text_ns = bench_now_ns() - t0;
+
+    // Binary: same content, drained every 8 records like an idle loop pass
+    FileSink sink(capture);
+    t0 = bench_now_ns();
+    for (int i = 0; i < n; i++) {
+        int idx = i % 121;
+        binlog_emit(BL_VOL_SET, idx, (idx - 60) * 5);
+        if (i % 8 == 7) binlog_drain(sink);
+        if (capture && i == n / 2) {
+            binlog_drain(sink);
+            sink.write((const uint8_t*)"[LAT] text line between records\n", 32);
+        }
+    }
+    binlog_drain(sink);
+    int64_t bin_ns = bench_now_ns() - t0;
+
+    const BinlogStats& st = binlog_stats();
+    printf("bench: binlog (%d records)\n", n);
+    printf("  printf text : %6.1f ns/record  %5.1f B/record\n",
+           (double)text_ns / n, (double)text_bytes / n);
+    printf("  BLOG + drain: %6.1f ns/record  %5.1f B/record  (dropped %u)\n",
+           (double)bin_ns / n, (double)sink.bytes / n, st.dropped);
+    printf("  at 115200 baud: text %.0f records/s max, binary %.0f records/s max\n",
+           11520.0 * n / text_bytes, 11520.0 * n / sink.bytes);
+
+    if (capture) {
+        fclose(capture);
+        printf("  capture written to %s\n", argv[1]);
+    }
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include "bench.h"
+#include "protocol/helix_parser.h"
+#include "protocol/dsp_state.h"
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// Replays configuration blobs through HelixRing + HelixParser with the
+// streaming DspBlobDecoder attached, in UART-sized chunks, and reports
+// time per blob and the RAM the decode path needs.
+// Usage: blob [count] [capture.bin]
+//   capture.bin: raw bytes recorded from the DSP UART (any frames; only
+//   0x50-byte blobs are decoded). Without it, blobs are synthesized with
+//   random field values, every 50th with a bad checksum, and the result
+//   is checked against the committed DspState.
+
+static void append_frame(std::vector<uint8_t>& out, const uint8_t* payload, uint8_t len)
+{
+    size_t at = out.size();
+    out.push_back(HELIX_SYNC);
+    out.push_back(len);
+    out.push_back((uint8_t)~len);
+    out.insert(out.end(), payload, payload + len);
+    out.push_back(helix_checksum(&out[at], len));
+}
+
+static uint32_t notified;
+
+static void count_cb(DspField, uint16_t, void*)
+{
+    notified++;
+}
+
+int bench_blob(int argc, char** argv)
+{
+    int count = bench_arg_int(argc, argv, 0, 20000);
+
+    std::vector<uint8_t> stream;
+    uint8_t last[HELIX_LEN_BLOB] = {};     // last good synthetic blob
+    uint32_t expect_bad = 0;
+    if (argc > 1) {
+        FILE* f = fopen(argv[1], "rb");
+        if (!f) { perror(argv[1]); return 1; }
+        int c;
+        while ((c = fgetc(f)) != EOF) stream.push_back((uint8_t)c);
+        fclose(f);
+    } else {
+        std::mt19937 rng(7);
+        uint8_t ready[HELIX_LEN_READY] = { 0x01, 0x2A, 0x00, 0x01 };
+        for (int i = 0; i < count; i++) {
+            uint8_t payload[HELIX_LEN_BLOB];
+            for (uint8_t& b : payload) b = (uint8_t)rng();
+            payload[0] = 0x01;
+            append_frame(stream, payload, HELIX_LEN_BLOB);
+            if (i % 50 == 49) {
+                stream.back() ^= 0x5A;
+                expect_bad++;
+            } else {
+                memcpy(last, payload, sizeof(last));
+            }
+            if (i % 4 == 0) append_frame(stream, ready, HELIX_LEN_READY);
+        }
+    }
+
+    printf("bench: blob (%zu bytes of DSP stream%s)\n", stream.size(), argc > 1 ? ", recorded" : "");
+
+    int mismatches = 0;
+    static const uint32_t chunks[] = { 1, 16, 64, 256 };
+    for (uint32_t chunk : chunks) {
+        static uint8_t buf[512];
+        HelixRing ring(buf, sizeof(buf));
+        HelixParser parser;
+        DspBlobDecoder dec;
+        parser.begin(nullptr);
+        dec.begin();
+        parser.setStream(dec.hooks());
+        for (int f = 0; f < DSP_FIELD_COUNT; f++) dec.subscribe((DspField)f, count_cb);
+        notified = 0;
+
+        uint32_t peak_ring = 0;
+        int64_t t0 = bench_now_ns();
+        for (size_t at = 0; at < stream.size();) {
+            uint32_t n = (uint32_t)(stream.size() - at < chunk ? stream.size() - at : chunk);
+            n = ring.push(&stream[at], n);
+            at += n;
+            if (ring.size() > peak_ring) peak_ring = ring.size();
+            parser.poll(ring);
+        }
+        int64_t ns = bench_now_ns() - t0;
+
+        const DspBlobStats& st = dec.stats();
+        printf("  chunk %3u B: %7.1f ns/blob  %6.1f MB/s  blobs=%u aborted=%u  notifies=%u  ring peak=%u B\n",
+               chunk, st.committed ? (double)ns / st.committed : 0.0,
+               stream.size() * 1e3 / ns, st.committed, st.aborted, notified, peak_ring);
+
+        if (argc <= 1) {
+            const DspState& s = dec.state();
+            bool ok = s.get(DSP_MASTER_INDEX) == last[0x08] &&
+                      s.get(DSP_FW_VERSION) == (last[0x03] | last[0x04] << 8) &&
+                      st.committed == count - expect_bad && st.aborted == expect_bad;
+            printf("    final state %s (master idx %u, fw %04X)\n", ok ? "ok" : "MISMATCH",
+                   s.get(DSP_MASTER_INDEX), s.get(DSP_FW_VERSION));
+            mismatches += !ok;
+        }
+    }
+
+    printf("  RAM: decoder %zu B (state %zu B, staging %zu B, %d subscriber slots) + %d B offset map\n",
+           sizeof(DspBlobDecoder), sizeof(DspState), sizeof(uint16_t) * DSP_FIELD_COUNT,
+           DSP_MAX_SUBSCRIBERS, HELIX_LEN_BLOB * 2);
+    printf("       no blob copy; buffering a whole frame instead would add %d B\n",
+           HELIX_LEN_BLOB + HELIX_OVERHEAD);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,59 @@
+#include "bench.h"
+#include "mem_display.h"
+#include "pages/master_dial.h"
+#include "model/params.h"
+#include "dsp_standin.h"
+#include <Arduino.h>
+#include <cstdio>
+
+// Runs N detent steps through master_dial_set_value(), forcing one
+// refresh per detent, sweeping up and down the full range.
+// Usage: dial [steps]
+int bench_dial(int argc, char** argv)
+{
+    int steps = bench_arg_int(argc, argv, 0, 2000);
+
+    Serial.setOutput(nullptr);   // per-detent printf is not what we measure
+
+    lv_display_t* disp = mem_display_create();
+    dsp_standin_link_up();       // the dial only moves on detents the link accepts
+    master_dial_create(lv_screen_active());
+    lv_refr_now(disp);           // first full frame is not a detent
+
+    BenchSamples frame_us;
+    BenchSamples px_per_detent;
+    BenchSamples inv_per_detent;
+    frame_us.reserve(steps);
+    px_per_detent.reserve(steps);
+    inv_per_detent.reserve(steps);
+
+    int dir = +1;
+    for (int i = 0; i < steps; i++) {
+        int v = master_dial_get_value();
+        if (v >= params_get(&param_master_max)) dir = -1;
+        if (v <= 0)   dir = +1;
+
+        mem_display_reset_counters();
+
+        uint64_t t0 = bench_now_ns();
+        master_dial_set_value(dir);
+        lv_refr_now(disp);
+        uint64_t t1 = bench_now_ns();
+
+        frame_us.add((t1 - t0) / 1000.0);
+        px_per_detent.add((double)mem_display_pixels_flushed());
+        inv_per_detent.add((double)master_dial_inv_stats().pending_px);
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    printf("bench: dial\n");
+    printf("detents: %d\n", steps);
+    frame_us.print("render_time", "us/frame");
+    px_per_detent.print("pixels_flushed", "px/detent");
+    inv_per_detent.print("pixels_invalidated", "px/detent");
+    printf("lv_heap_high_water: %u bytes (of %u)\n",
+           (unsigned)mon.max_used, (unsigned)mon.total_size);
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include "bench.h"
+#include "input/encoder.h"
+#include <cstdio>
+#include <vector>
+
+// Replays synthetic quadrature traces through EncoderRing +
+// EncoderDecoder. Traces are walked from enc_transition_table, so they
+// are exactly what the ISR would record for a given spin.
+// Usage: encoder [flick_detents] [flick_rate_hz]
+
+struct Trace {
+    std::vector<EncEvent> ev;
+    uint8_t state = 0;
+    uint32_t t_us = 0;
+
+    // n detents in direction dir at rate detents/s
+    void spin(int n, int dir, uint32_t rate)
+    {
+        uint32_t step_us = 1000000u / rate / ENC_TRANSITIONS_PER_DETENT;
+        for (int i = 0; i < n * ENC_TRANSITIONS_PER_DETENT; i++) {
+            uint8_t next = 0;
+            while (enc_transition_table[state][next] != dir) next++;
+            state = next;
+            t_us += step_us;
+            ev.push_back({ t_us, state, 0 });
+        }
+    }
+
+    void pause(uint32_t ms) { t_us += ms * 1000; }
+
+    // Like spin(), but every edge chatters: the channel that just
+    // changed flips back and forth `bounces` times, 20us apart, and the
+    // last look the ISR gets is a flip-back. The settled level is only
+    // read with the next edge, on the other channel: unfiltered that is
+    // a double jump, after which the chatter decodes as steps backwards.
+    void spin_bouncy(int n, int dir, uint32_t rate, int bounces)
+    {
+        uint32_t step_us = 1000000u / rate / ENC_TRANSITIONS_PER_DETENT;
+        for (int i = 0; i < n * ENC_TRANSITIONS_PER_DETENT; i++) {
+            uint8_t next = 0;
+            while (enc_transition_table[state][next] != dir) next++;
+            t_us += step_us;
+            uint8_t prev = state;
+            for (int b = 0; b < bounces; b++) {
+                ev.push_back({ t_us, next, 0 });
+                ev.push_back({ t_us + 10, prev, 0 });
+                t_us += 20;
+            }
+            state = next;
+        }
+        ev.push_back({ t_us, state, 0 });   // at rest: the last edge settles
+    }
+};
+
+static int replay(const Trace& tr, EncAccel accel, int* max_step,
+                  EncoderFilter* filter = nullptr)
+{
+    EncoderRing ring;
+    EncoderDecoder dec;
+    dec.begin(0, accel);
+    if (filter) filter->begin(0, 1);    // host: 1 "cycle" per us
+
+    int total = 0;
+    *max_step = 0;
+    for (const EncEvent& e : tr.ev) {
+        if (filter && !filter->edge(e.state, e.t_us)) continue;
+        ring.push(e.t_us, e.state);
+        int d = dec.poll(ring);     // one poll per event, like a fast loop()
+        total += d;
+        if (d > *max_step) *max_step = d;
+        if (-d > *max_step) *max_step = -d;
+    }
+    return total;
+}
+
+static bool scenario(const char* name, const Trace& tr, int expect_min, int expect_max)
+{
+    int max_on, max_off;
+    int on = replay(tr, ENC_ACCEL_DEFAULT, &max_on);
+    int off = replay(tr, ENC_ACCEL_OFF, &max_off);
+    bool ok = on >= expect_min && on <= expect_max;
+    printf("%-22s raw=%+5d  accel=%+5d  (max step %d)  %s\n",
+           name, off, on, max_on, ok ? "ok" : "UNEXPECTED");
+    return ok;
+}
+
+int bench_encoder(int argc, char** argv)
+{
+    int flick = bench_arg_int(argc, argv, 0, 20);
+    int rate = bench_arg_int(argc, argv, 1, 100);
+
+    printf("bench: encoder (accel v_lo=%d v_hi=%d x%d)\n",
+           ((EncAccel)ENC_ACCEL_DEFAULT).v_lo, ((EncAccel)ENC_ACCEL_DEFAULT).v_hi,
+           ((EncAccel)ENC_ACCEL_DEFAULT).max_mult);
+
+    int failed = 0;
+    Trace slow;
+    slow.spin(10, +1, 5);
+    failed += !scenario("slow 10 @5/s", slow, 10, 10);
+
+    Trace fl;
+    fl.spin(flick, +1, rate);
+    char name[32];
+    snprintf(name, sizeof(name), "flick %d @%d/s", flick, rate);
+    failed += !scenario(name, fl, 120, 100000);     // must cover the full masterIndex range
+
+    Trace rev;
+    rev.spin(15, +1, 80);
+    rev.spin(3, -1, 80);
+    failed += !scenario("fast then reverse 3", rev, 1, 100000);
+
+    Trace gest;
+    gest.spin(15, +1, 80);
+    gest.pause(400);
+    gest.spin(1, +1, 80);
+    failed += !scenario("flick, pause, 1 click", gest, 16, 100000);
+
+    // Contact bounce through the ISR filter
+    Trace bouncy;
+    bouncy.spin_bouncy(30, +1, 20, 3);
+    int m;
+    EncoderFilter filt;
+    int raw = replay(bouncy, ENC_ACCEL_OFF, &m);
+    int filtered = replay(bouncy, ENC_ACCEL_OFF, &m, &filt);
+    const EncIsrStats& fs = filt.stats();
+    bool bounce_ok = raw != 30 && filtered == 30 && fs.rej_bounce > 0;
+    printf("%-22s unfiltered=%+4d  filtered=%+4d (expect +30, unfiltered off)  %s\n",
+           "bouncy 30 @20/s", raw, filtered, bounce_ok ? "ok" : "UNEXPECTED");
+    failed += !bounce_ok;
+    printf("  isr filter: edges=%u accepted=%u nochange=%u invalid=%u bounce=%u\n",
+           fs.edges, fs.accepted, fs.rej_nochange, fs.rej_invalid, fs.rej_bounce);
+
+    // Throughput of the decoder itself
+    Trace big;
+    for (int i = 0; i < 20000; i++) big.spin(5, (i & 1) ? -1 : +1, 50 + i % 100);
+    EncoderDecoder dec;
+    dec.begin(0);
+    uint64_t t0 = bench_now_ns();
+    int sink = 0;
+    for (const EncEvent& e : big.ev) sink += dec.feed(e);
+    uint64_t dt = bench_now_ns() - t0;
+    printf("decode: %.1f ns/transition (%zu transitions, sum %d)\n",
+           (double)dt / big.ev.size(), big.ev.size(), sink);
+    return failed ? 1 : 0;
+}
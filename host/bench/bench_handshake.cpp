@@ -0,0 +1,113 @@
+#include "bench.h"
+#include "dsp_standin.h"
+#include "protocol/helix_protocol.h"
+#include "protocol/helix_handshake.h"
+#include "model/params.h"
+#include <cstdio>
+
+// Runs helix_begin()/helix_loop() against DspStandIn on a virtual 1 ms
+// clock and reports time-to-ready per fault scenario, plus a DSP restart
+// after the link is up.
+// Usage: handshake [trials]
+
+struct Scenario {
+    const char* name;
+    DspStandInConfig cfg;
+};
+
+static const uint32_t GIVE_UP_MS = 60000;
+
+static bool run_until_ready(uint32_t limit_ms)
+{
+    for (uint32_t t = 0; t < limit_ms; t++) {
+        helix_loop();
+        if (helix_ready()) return true;
+        host_time_advance_us(1000);
+    }
+    return false;
+}
+
+int bench_handshake(int argc, char** argv)
+{
+    int trials = bench_arg_int(argc, argv, 0, 200);
+    host_time_virtual(true);
+
+    Scenario scenarios[] = {
+        { "clean, 2 ms latency",    {} },
+        { "DSP boots +1.5 s",       {} },
+        { "DSP boots +10 s",        {} },
+        { "30% responses dropped",  {} },
+        { "20% responses corrupt",  {} },
+        { "20 ms latency, 10% drop", {} },
+    };
+    scenarios[1].cfg.boot_ms = 1500;
+    scenarios[2].cfg.boot_ms = 10000;
+    scenarios[3].cfg.drop_pct = 30;
+    scenarios[4].cfg.corrupt_pct = 20;
+    scenarios[5].cfg.latency_ms = 20;
+    scenarios[5].cfg.drop_pct = 10;
+
+    printf("bench: handshake (%d trials each, timeout %u..%u ms x2 backoff)\n",
+           trials, HELIX_HS_TIMEOUT_MS, HELIX_HS_TIMEOUT_MAX_MS);
+
+    int bad = 0;        // checks that failed; any makes the bench fail
+    for (Scenario& sc : scenarios) {
+        BenchSamples ttr, pkts;
+        int failed = 0, wrong_state = 0;
+        for (int i = 0; i < trials; i++) {
+            DspStandInConfig cfg = sc.cfg;
+            cfg.seed = 1000 + i;
+            cfg.boot_ms += millis();
+            DspStandIn dsp(cfg);
+            dsp.state().value[DSP_MASTER_INDEX] = 10 + i % 100;
+
+            helix_begin(dsp);
+            if (!run_until_ready(GIVE_UP_MS)) {
+                failed++;
+                continue;
+            }
+            const HelixLinkStats& ls = helix_link_stats();
+            ttr.add(ls.time_to_ready_ms);
+            pkts.add(ls.packets_sent);
+            if (helix_dsp_state().get(DSP_MASTER_INDEX) != dsp.state().get(DSP_MASTER_INDEX))
+                wrong_state++;
+        }
+        printf("%s\n", sc.name);
+        ttr.print("  time to ready", "ms");
+        pkts.print("  HS packets sent", "");
+        printf("  never ready: %d  blob mismatch: %d\n", failed, wrong_state);
+        bad += failed + wrong_state;
+    }
+
+    // DSP power-cycles under a live link
+    DspStandInConfig cfg;
+    DspStandIn dsp(cfg);
+    helix_begin(dsp);
+    run_until_ready(GIVE_UP_MS);
+    dsp.state().value[DSP_MASTER_INDEX] = 77;   // comes back with a different volume
+    dsp.restart();
+    for (int t = 0; t < 1000; t++) {
+        helix_loop();
+        host_time_advance_us(1000);
+    }
+    const HelixLinkStats& ls = helix_link_stats();
+    int32_t idx = params_get(&param_master_index);
+    bool resync_ok = ls.handshakes == 2 && idx == 77 && dsp.stats().writes == 0;
+    printf("DSP restart after ready\n  handshakes=%u  re-sync=%u ms  store idx %d (expect 77)  echoed writes %u  %s\n",
+           ls.handshakes, ls.last_sync_ms, idx, dsp.stats().writes, resync_ok ? "ok" : "UNEXPECTED");
+    bad += !resync_ok;
+
+    // Encoder intent still goes out after a DSP-originated update
+    helix_volume_delta(+3);
+    for (int t = 0; t < 100; t++) {
+        helix_loop();
+        host_time_advance_us(1000);
+    }
+    bool delta_ok = dsp.state().get(DSP_MASTER_INDEX) == 80;
+    printf("  +3 detents: DSP idx %u (expect 80)  %s\n", dsp.state().get(DSP_MASTER_INDEX),
+           delta_ok ? "ok" : "UNEXPECTED");
+    bad += !delta_ok;
+
+    host_time_virtual(false);
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,88 @@
+#include "bench.h"
+#include "mem_display.h"
+#include "pages/digit_cache.h"
+#include <Arduino.h>
+#include <cstdio>
+
+// Draw time of the 48px centre value: Montserrat 48 label (glyphs
+// re-rasterized with AA every draw) vs blits from the digit cache.
+// Two digits change per iteration, like 49 → 50.
+// Usage: label [iterations]
+
+static const char* const TEXT[10] = { "0","1","2","3","4","5","6","7","8","9" };
+
+static void report(const char* name, BenchSamples& s)
+{
+    printf("[%s]\n", name);
+    s.print("  draw", "us/update");
+}
+
+int bench_label(int argc, char** argv)
+{
+    int iters = bench_arg_int(argc, argv, 0, 2000);
+
+    Serial.setOutput(nullptr);
+
+    lv_display_t* disp = mem_display_create();
+    lv_obj_t* scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x000000), 0);
+
+    const lv_font_t* font = &lv_font_montserrat_48;
+    const lv_color_t fg = lv_color_hex(0xFFFFFF);
+    const lv_color_t bg = lv_color_hex(0x000000);
+
+    // Before: two label cells
+    lv_obj_t* labels[2];
+    for (int i = 0; i < 2; i++) {
+        labels[i] = lv_label_create(scr);
+        lv_obj_set_style_text_font(labels[i], font, 0);
+        lv_obj_set_style_text_color(labels[i], fg, 0);
+        lv_obj_align(labels[i], LV_ALIGN_CENTER, (i ? 1 : -1) * 16, 0);
+    }
+    lv_refr_now(disp);
+
+    BenchSamples label_us;
+    for (int n = 0; n < iters; n++) {
+        lv_label_set_text_static(labels[0], TEXT[n % 10]);
+        lv_label_set_text_static(labels[1], TEXT[(n + 3) % 10]);
+        mem_display_reset_counters();
+        uint64_t t0 = bench_now_ns();
+        lv_refr_now(disp);
+        uint64_t dt = bench_now_ns() - t0 - mem_display_flush_ns();
+        label_us.add(dt / 1000.0);
+    }
+
+    for (int i = 0; i < 2; i++) lv_obj_delete(labels[i]);
+
+    // After: two image cells out of the cache
+    uint64_t tb = bench_now_ns();
+    digit_cache_build(scr, font, fg, bg);
+    double build_us = (bench_now_ns() - tb) / 1000.0;
+
+    lv_obj_t* cells[2];
+    for (int i = 0; i < 2; i++) {
+        cells[i] = lv_image_create(scr);
+        lv_obj_align(cells[i], LV_ALIGN_CENTER, (i ? 1 : -1) * digit_cache_cell_w() / 2, 0);
+    }
+    lv_refr_now(disp);
+
+    BenchSamples cache_us;
+    for (int n = 0; n < iters; n++) {
+        lv_image_set_src(cells[0], digit_cache_get(n % 10));
+        lv_image_set_src(cells[1], digit_cache_get((n + 3) % 10));
+        mem_display_reset_counters();
+        uint64_t t0 = bench_now_ns();
+        lv_refr_now(disp);
+        uint64_t dt = bench_now_ns() - t0 - mem_display_flush_ns();
+        cache_us.add(dt / 1000.0);
+    }
+
+    printf("bench: label\n");
+    report("label (montserrat_48)", label_us);
+    report("digit cache blit", cache_us);
+    printf("cache: %dx%d px/digit, ~%u bytes, built in %.0f us\n",
+           (int)digit_cache_cell_w(), (int)digit_cache_cell_h(),
+           (unsigned)(digit_cache_cell_w() * digit_cache_cell_h() * 2 * DIGIT_CACHE_GLYPHS), build_us);
+    printf("speedup: %.2fx (p50)\n", label_us.percentile(50) / cache_us.percentile(50));
+    return 0;
+}
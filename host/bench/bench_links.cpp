@@ -0,0 +1,81 @@
+#include "bench.h"
+#include "dsp_standin.h"
+#include "protocol/helix_link.h"
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+// Many HelixLinks in one process, each against its own DspStandIn, on
+// a virtual 1 ms clock. Brings all of them up, then steps every link's
+// master volume once per TX interval and checks each DSP ended up with
+// its link's value. Reports per-link RAM and host cost per link pass.
+// Usage: links [count] [seconds]
+
+int bench_links(int argc, char** argv)
+{
+    int count = bench_arg_int(argc, argv, 0, 1000);
+    int seconds = bench_arg_int(argc, argv, 1, 10);
+    host_time_virtual(true);
+
+    printf("bench: links (%d links, %d s virtual)\n", count, seconds);
+    printf("footprint: %zu bytes/link (budget %u, rx ring %u)  total %.1f KB\n",
+           HELIX_LINK_FOOTPRINT, (unsigned)HELIX_LINK_MAX_BYTES, (unsigned)HELIX_RX_RING_SIZE,
+           count * HELIX_LINK_FOOTPRINT / 1024.0);
+
+    std::unique_ptr<HelixLink[]> links(new HelixLink[count]);
+    std::vector<std::unique_ptr<DspStandIn>> dsps;
+    std::vector<HelixSerialTransport> io(count);
+    for (int i = 0; i < count; i++) {
+        DspStandInConfig cfg;
+        cfg.seed = 1 + i;
+        cfg.latency_ms = 1 + i % 5;
+        dsps.emplace_back(new DspStandIn(cfg));
+        dsps[i]->state().value[DSP_MASTER_INDEX] = i % 100;
+        io[i].attach(*dsps[i]);
+        links[i].begin(io[i]);
+    }
+
+    uint64_t loops = 0, loop_ns = 0;
+    auto pass = [&]() {
+        uint64_t t0 = bench_now_ns();
+        for (int i = 0; i < count; i++)
+            links[i].loop();
+        loop_ns += bench_now_ns() - t0;
+        loops += count;
+        host_time_advance_us(1000);
+    };
+
+    int up_ms = 0, ready = 0;
+    for (; up_ms < 5000 && ready < count; up_ms++) {
+        pass();
+        ready = 0;
+        for (int i = 0; i < count; i++)
+            ready += links[i].ready();
+    }
+    printf("ready: %d/%d after %d ms\n", ready, count, up_ms);
+
+    uint32_t step_ms = HELIX_TX_MIN_INTERVAL_MS + 1;
+    for (int ms = 0; ms < seconds * 1000; ms++) {
+        if (ms % step_ms == 0) {
+            for (int i = 0; i < count; i++)
+                links[i].volume_delta((ms / step_ms) % 20 < 10 ? 1 : -1);
+        }
+        pass();
+    }
+    for (int ms = 0; ms < 100; ms++) pass();    // drain TX and responses
+
+    uint64_t sent = 0, frames = 0, writes = 0;
+    int mismatch = 0;
+    for (int i = 0; i < count; i++) {
+        sent += links[i].tx_stats().sent;
+        frames += links[i].rx_stats().frames_ok;
+        writes += dsps[i]->stats().writes;
+        if (dsps[i]->state().get(DSP_MASTER_INDEX) != links[i].master().index) mismatch++;
+    }
+
+    printf("link pass: %.1f ns (%llu passes)\n", (double)loop_ns / loops, (unsigned long long)loops);
+    printf("volume writes: sent=%llu applied=%llu  rx frames=%llu  DSP/link mismatch: %d\n",
+           (unsigned long long)sent, (unsigned long long)writes, (unsigned long long)frames, mismatch);
+    host_time_virtual(false);
+    return mismatch ? 1 : 0;
+}
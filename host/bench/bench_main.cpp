@@ -0,0 +1,63 @@
+#include "bench.h"
+#include <cstdio>
+#include <cstring>
+
+// Host benchmark entry point for [env:native].
+//   pio run -e native && .pio/build/native/program <case> [args...]
+
+int bench_dial(int argc, char** argv);
+int bench_parser(int argc, char** argv);
+int bench_swap(int argc, char** argv);
+int bench_round(int argc, char** argv);
+int bench_label(int argc, char** argv);
+int bench_encoder(int argc, char** argv);
+int bench_binlog(int argc, char** argv);
+int bench_blob(int argc, char** argv);
+int bench_handshake(int argc, char** argv);
+int bench_pty(int argc, char** argv);
+int bench_dspsim(int argc, char** argv);
+int bench_links(int argc, char** argv);
+
+struct BenchCase {
+    const char* name;
+    const char* help;
+    bench_fn    run;
+};
+
+static const BenchCase cases[] = {
+    { "dial",   "[steps]  detent render cost of master_dial", bench_dial },
+    { "parser", "[MB] [chunk]  Helix RX parser throughput and rejects", bench_parser },
+    { "swap",   "[frames]  RGB565 + swap-on-flush vs native RGB565_SWAPPED", bench_swap },
+    { "round",  "[detents]  SPI bytes saved by round-panel clipping", bench_round },
+    { "label",  "[iterations]  48px value draw: label vs digit glyph cache", bench_label },
+    { "encoder", "[detents] [rate]  encoder decoder on synthetic quadrature traces", bench_encoder },
+    { "binlog", "[records] [capture.bin]  binary log ring vs printf per hot-path call", bench_binlog },
+    { "blob",   "[count] [capture.bin]  streaming DSP config blob decode", bench_blob },
+    { "handshake", "[trials]  link handshake vs a faulty DSP stand-in (virtual time)", bench_handshake },
+    { "pty",    "[commands] [latency] [jitter] [loss/1000]  volume round trips to a DSP simulator over a pty", bench_pty },
+    { "dspsim", "[latency] [jitter] [loss/1000]  serve the DSP simulator on a pty until killed", bench_dspsim },
+    { "links",  "[count] [seconds]  many HelixLinks against in-process stand-ins (virtual time)", bench_links },
+};
+
+static void usage(const char* prog)
+{
+    printf("usage: %s <case> [args...]\n", prog);
+    for (const BenchCase& c : cases)
+        printf("  %-10s %s\n", c.name, c.help);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    for (const BenchCase& c : cases) {
+        if (strcmp(argv[1], c.name) == 0)
+            return c.run(argc - 2, argv + 2);
+    }
+
+    usage(argv[0]);
+    return 1;
+}
@@ -0,0 +1,91 @@
+#include "bench.h"
+#include "protocol/helix_parser.h"
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Feeds a synthetic DSP byte stream through HelixRing + HelixParser in
+// UART-sized chunks. The stream mixes valid frames with corrupted
+// checksums, broken ~len bytes and bursts of line noise.
+// Usage: parser [megabytes] [chunk_bytes]
+
+struct Injected {
+    uint32_t valid, bad_checksum, bad_length, noise_bytes;
+};
+
+static void append_frame(std::vector<uint8_t>& out, std::mt19937& rng, Injected& inj)
+{
+    uint8_t len = rng() % (HELIX_LEN_BLOB + 1);
+    size_t at = out.size();
+
+    out.push_back(HELIX_SYNC);
+    out.push_back(len);
+    out.push_back((uint8_t)~len);
+    for (int i = 0; i < len; i++) out.push_back((uint8_t)rng());
+    out.push_back(helix_checksum(&out[at], len));
+
+    uint32_t r = rng() % 100;
+    if (r < 5) {
+        out.back() ^= 0x5A;
+        inj.bad_checksum++;
+    } else if (r < 8) {
+        out[at + 2] ^= 0x01;
+        inj.bad_length++;
+    } else {
+        inj.valid++;
+    }
+
+    if (rng() % 100 < 5) {
+        int n = 1 + rng() % 16;
+        for (int i = 0; i < n; i++) out.push_back((uint8_t)rng());
+        inj.noise_bytes += n;
+    }
+}
+
+static void count_frame(const HelixFrame&, void* ctx)
+{
+    (*(uint32_t*)ctx)++;
+}
+
+int bench_parser(int argc, char** argv)
+{
+    int mb = bench_arg_int(argc, argv, 0, 16);
+    int chunk = bench_arg_int(argc, argv, 1, 64);
+
+    std::mt19937 rng(1234);
+    std::vector<uint8_t> stream;
+    stream.reserve((size_t)mb << 20);
+    Injected inj = {};
+    while (stream.size() < ((size_t)mb << 20))
+        append_frame(stream, rng, inj);
+
+    static uint8_t buf[512];
+    HelixRing ring(buf, sizeof(buf));
+    HelixParser parser;
+    uint32_t delivered = 0;
+    parser.begin(count_frame, &delivered);
+
+    uint64_t t0 = bench_now_ns();
+    size_t off = 0;
+    while (off < stream.size()) {
+        size_t n = stream.size() - off;
+        if (n > (size_t)chunk) n = chunk;
+        n = ring.push(&stream[off], n);
+        off += n;
+        parser.poll(ring);
+    }
+    uint64_t t1 = bench_now_ns();
+
+    const HelixParserStats& s = parser.stats();
+    double secs = (t1 - t0) / 1e9;
+
+    printf("bench: parser\n");
+    printf("stream: %zu bytes, chunk %d\n", stream.size(), chunk);
+    printf("throughput: %.1f MB/s\n", stream.size() / secs / (1 << 20));
+    printf("injected: valid=%u bad_checksum=%u bad_length=%u noise_bytes=%u\n",
+           inj.valid, inj.bad_checksum, inj.bad_length, inj.noise_bytes);
+    printf("accepted: %u (delivered %u)\n", s.frames_ok, delivered);
+    printf("rejected: bad_checksum=%u bad_length=%u\n", s.bad_checksum, s.bad_length);
+    printf("skipped: %u bytes\n", s.bytes_skipped);
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include "bench.h"
+#include "pty_link.h"
+#include "protocol/helix_protocol.h"
+#include "protocol/helix_handshake.h"
+#include "protocol/helix_packets.h"
+#include "protocol/helix_tx.h"
+#include "model/params.h"
+#include <csignal>
+#include <cstdio>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// helix_begin()/helix_loop()/helix_volume_delta() over a real pty, in
+// real time, against dsp_sim_serve() in a child process. The stand-in
+// acks every volume write; a tap on the controller's transport times
+// each command from helix_volume_delta() (intent) and from the packet
+// leaving for the pty (wire) to its ack arriving.
+// Usage: pty [commands] [latency_ms] [jitter_ms] [byte_loss_pm]
+//        dspsim [latency_ms] [jitter_ms] [byte_loss_pm]   (serve only)
+
+static const uint32_t ACK_TIMEOUT_MS = 500;
+
+// Controller transport with timestamps on volume writes and acks
+class TapSerial : public PtySerial {
+public:
+    explicit TapSerial(int fd) : PtySerial(fd), ring_(ring_buf_, sizeof(ring_buf_))
+    {
+        parser_.begin(on_frame, this);
+    }
+
+    size_t read(uint8_t* buf, size_t len) override
+    {
+        size_t n = PtySerial::read(buf, len);
+        ring_.push(buf, (uint32_t)n);
+        parser_.poll(ring_);
+        return n;
+    }
+    using PtySerial::read;
+
+    size_t write(const uint8_t* buf, size_t len) override
+    {
+        if (len == HelixParamPacket::size && buf[1] == HELIX_PARAM_LEN_BYTE)
+            wire_ns[buf[HELIX_PARAM_VALUE_AT]] = bench_now_ns();
+        return PtySerial::write(buf, len);
+    }
+    using PtySerial::write;
+
+    uint64_t wire_ns[256] = {};
+    uint64_t ack_ns[256] = {};
+
+private:
+    static void on_frame(const HelixFrame& f, void* ctx)
+    {
+        if (f.len == DSP_STANDIN_ACK_LEN && f[4] == 0x06)
+            ((TapSerial*)ctx)->ack_ns[f[3]] = bench_now_ns();
+    }
+
+    uint8_t ring_buf_[1024];
+    HelixRing ring_;
+    HelixParser parser_;
+};
+
+static DspStandInConfig sim_config(int argc, char** argv, int first)
+{
+    DspStandInConfig cfg;
+    cfg.latency_ms   = bench_arg_int(argc, argv, first, 2);
+    cfg.jitter_ms    = bench_arg_int(argc, argv, first + 1, 3);
+    cfg.byte_loss_pm = bench_arg_int(argc, argv, first + 2, 0);
+    cfg.ack_writes = true;
+    return cfg;
+}
+
+// Runs helix_loop(), sleeping on the pty between passes
+static void pump_for(int fd, uint32_t ms, bool (*done)(void*), void* ctx)
+{
+    uint32_t t0 = millis();
+    while (millis() - t0 < ms) {
+        helix_loop();
+        if (done && done(ctx)) return;
+        pollfd p = { fd, POLLIN, 0 };
+        poll(&p, 1, 1);
+    }
+}
+
+static bool link_ready(void*) { return helix_ready(); }
+
+struct AckWait {
+    TapSerial* tap;
+    uint8_t value;
+};
+
+static bool acked(void* ctx)
+{
+    AckWait* w = (AckWait*)ctx;
+    return w->tap->ack_ns[w->value] != 0;
+}
+
+int bench_dspsim(int argc, char** argv)
+{
+    char path[64];
+    int master = pty_open(path, sizeof(path));
+    if (master < 0) {
+        perror("pty_open");
+        return 1;
+    }
+    DspStandInConfig cfg = sim_config(argc, argv, 0);
+    printf("dspsim: %s  latency=%ums jitter=%ums byte loss=%u/1000\n",
+           path, cfg.latency_ms, cfg.jitter_ms, cfg.byte_loss_pm);
+    fflush(stdout);
+    dsp_sim_serve(master, cfg);
+    return 0;
+}
+
+int bench_pty(int argc, char** argv)
+{
+    int commands = bench_arg_int(argc, argv, 0, 500);
+    DspStandInConfig cfg = sim_config(argc, argv, 1);
+
+    char path[64];
+    int master = pty_open(path, sizeof(path));
+    if (master < 0) {
+        perror("pty_open");
+        return 1;
+    }
+
+    printf("bench: pty (%d commands, latency=%ums jitter=%ums byte loss=%u/1000, %s)\n",
+           commands, cfg.latency_ms, cfg.jitter_ms, cfg.byte_loss_pm, path);
+    fflush(stdout);
+
+    pid_t sim = fork();
+    if (sim < 0) {
+        perror("fork");
+        return 1;
+    }
+    if (sim == 0) {
+        dsp_sim_serve(master, cfg);
+        _exit(0);
+    }
+    close(master);
+
+    int fd = pty_open_slave(path);
+    TapSerial tap(fd);
+    helix_begin(tap);
+    pump_for(fd, 10000, link_ready, nullptr);
+
+    int lost = 0;
+    if (!helix_ready()) {
+        printf("link never came up\n");
+        lost = -1;
+    } else {
+        printf("time to ready: %u ms (%u HS packets)\n",
+               helix_link_stats().time_to_ready_ms, helix_link_stats().packets_sent);
+
+        BenchSamples intent, wire;
+        int dir = 1;
+        for (int i = 0; i < commands; i++) {
+            int32_t idx = params_get(&param_master_index);
+            if (idx + dir < 0 || idx + dir > params_get(&param_master_max)) dir = -dir;
+
+            AckWait w = { &tap, (uint8_t)(idx + dir) };
+            tap.wire_ns[w.value] = tap.ack_ns[w.value] = 0;
+
+            uint64_t t0 = bench_now_ns();
+            helix_volume_delta(dir);
+            pump_for(fd, ACK_TIMEOUT_MS, acked, &w);
+
+            if (!acked(&w) || !tap.wire_ns[w.value]) {
+                lost++;
+            } else {
+                intent.add((tap.ack_ns[w.value] - t0) / 1e3);
+                wire.add((tap.ack_ns[w.value] - tap.wire_ns[w.value]) / 1e3);
+            }
+            // Next command after the TX interval, so none coalesce
+            pump_for(fd, HELIX_TX_MIN_INTERVAL_MS + 1, nullptr, nullptr);
+        }
+
+        intent.print("intent→ack", "us");
+        wire.print("wire→ack", "us");
+        printf("acks lost: %d  rx frames ok=%u bad len=%u bad sum=%u\n", lost,
+               helix_rx_stats().frames_ok, helix_rx_stats().bad_length, helix_rx_stats().bad_checksum);
+    }
+
+    kill(sim, SIGTERM);
+    waitpid(sim, nullptr, 0);
+    close(fd);
+    return lost < 0 ? 1 : 0;
+}
@@ -0,0 +1,79 @@
+#include "bench.h"
+#include "mem_display.h"
+#include "pages/master_dial.h"
+#include "model/params.h"
+#include "dsp_standin.h"
+#include <Arduino.h>
+#include <cstdio>
+
+// SPI bytes per frame with and without DISPLAY_ROUND_CLIP, for dial
+// detents and for full-screen refreshes. Both clipped flushes are
+// measured: the packed bounding box my_flush_dma_cb sends (the default
+// build) and the exact row spans of the blocking my_flush_cb.
+// Usage: round [detents]
+
+struct RoundResult {
+    double detent_bytes;
+    double full_bytes;
+};
+
+static RoundResult run(lv_display_t* disp, MemRound mode, const char* name, int detents)
+{
+    mem_display_set_round(disp, mode);
+
+    BenchSamples detent_bytes, full_bytes;
+    int dir = +1;
+
+    for (int i = 0; i < detents; i++) {
+        int v = master_dial_get_value();
+        if (v >= params_get(&param_master_max)) dir = -1;
+        if (v <= 0)   dir = +1;
+        master_dial_set_value(dir);
+
+        mem_display_reset_counters();
+        lv_refr_now(disp);
+        detent_bytes.add(mem_display_pixels_flushed() * 2.0);
+
+        if (i % 10 == 0) {
+            lv_obj_invalidate(lv_screen_active());
+            mem_display_reset_counters();
+            lv_refr_now(disp);
+            full_bytes.add(mem_display_pixels_flushed() * 2.0);
+        }
+    }
+
+    printf("[%s]\n", name);
+    detent_bytes.print("  detent", "B/frame");
+    full_bytes.print("  full", "B/frame");
+    return { detent_bytes.mean(), full_bytes.mean() };
+}
+
+static void print_saved(const char* name, const RoundResult& sq, const RoundResult& rd)
+{
+    printf("%-9s saved per detent: %.0f B (%.1f%%)  per full frame: %.0f B (%.1f%%)\n", name,
+           sq.detent_bytes - rd.detent_bytes,
+           100.0 * (sq.detent_bytes - rd.detent_bytes) / sq.detent_bytes,
+           sq.full_bytes - rd.full_bytes,
+           100.0 * (sq.full_bytes - rd.full_bytes) / sq.full_bytes);
+}
+
+int bench_round(int argc, char** argv)
+{
+    int detents = bench_arg_int(argc, argv, 0, 500);
+
+    Serial.setOutput(nullptr);
+
+    lv_display_t* disp = mem_display_create();
+    dsp_standin_link_up();       // the dial only moves on detents the link accepts
+    master_dial_create(lv_screen_active());
+    lv_refr_now(disp);
+
+    printf("bench: round\n");
+    RoundResult sq = run(disp, MEM_ROUND_OFF, "square", detents);
+    RoundResult box = run(disp, MEM_ROUND_BOX, "round clip, DMA box (default)", detents);
+    RoundResult spans = run(disp, MEM_ROUND_SPANS, "round clip, row spans (no DMA)", detents);
+
+    print_saved("DMA box", sq, box);
+    print_saved("row spans", sq, spans);
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include "bench.h"
+#include "mem_display.h"
+#include "pages/master_dial.h"
+#include "model/params.h"
+#include "dsp_standin.h"
+#include <Arduino.h>
+#include <cstdio>
+
+// Full-screen refreshes of the dial in both DISPLAY_NATIVE_SWAP pipelines:
+//   swap-on-flush: render RGB565, byte-swap every pixel while flushing
+//   native:        render RGB565_SWAPPED, flush is a plain copy
+// Switching the display's format makes the dial rebuild its glyph cache
+// and ring images in that byte order, so both runs draw them as copies.
+// Round clipping stays as built: only on-glass pixels are flushed.
+// Usage: swap [frames]
+
+static void run(lv_display_t* disp, bool native, int frames)
+{
+    mem_display_set_native_swap(disp, native);
+
+    BenchSamples render_us, flush_us, swapped_px;
+    int dir = +1;
+
+    for (int i = 0; i < frames; i++) {
+        int v = master_dial_get_value();
+        if (v >= params_get(&param_master_max)) dir = -1;
+        if (v <= 0)   dir = +1;
+        master_dial_set_value(dir);
+        lv_obj_invalidate(lv_screen_active());
+
+        mem_display_reset_counters();
+        uint64_t t0 = bench_now_ns();
+        lv_refr_now(disp);
+        uint64_t total = bench_now_ns() - t0;
+        uint64_t flush = mem_display_flush_ns();
+
+        render_us.add((total - flush) / 1000.0);
+        flush_us.add(flush / 1000.0);
+        swapped_px.add(native ? 0.0 : (double)mem_display_pixels_flushed());
+    }
+
+    printf("[%s]\n", native ? "native RGB565_SWAPPED" : "RGB565 + swap on flush");
+    render_us.print("  render", "us/frame");
+    flush_us.print("  flush", "us/frame");
+    printf("  swaps: %.0f px/frame (of %u)\n", swapped_px.mean(), (unsigned)(MEM_DISPLAY_W * MEM_DISPLAY_H));
+}
+
+int bench_swap(int argc, char** argv)
+{
+    int frames = bench_arg_int(argc, argv, 0, 500);
+
+    Serial.setOutput(nullptr);
+
+    lv_display_t* disp = mem_display_create();
+    dsp_standin_link_up();       // the dial only moves on detents the link accepts
+    master_dial_create(lv_screen_active());
+    lv_refr_now(disp);
+
+    printf("bench: swap\n");
+    printf("frames: %d (full-screen)\n", frames);
+    run(disp, false, frames);
+    run(disp, true, frames);
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include "bench.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+uint64_t bench_now_ns()
+{
+    auto t = std::chrono::steady_clock::now().time_since_epoch();
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(t).count();
+}
+
+int bench_arg_int(int argc, char** argv, int idx, int def)
+{
+    if (idx >= argc) return def;
+    return atoi(argv[idx]);
+}
+
+double BenchSamples::mean() const
+{
+    if (v_.empty()) return 0;
+    double sum = 0;
+    for (double x : v_) sum += x;
+    return sum / v_.size();
+}
+
+double BenchSamples::percentile(double p)
+{
+    if (v_.empty()) return 0;
+    if (!sorted_) {
+        std::sort(v_.begin(), v_.end());
+        sorted_ = true;
+    }
+    size_t i = (size_t)(p / 100.0 * (v_.size() - 1) + 0.5);
+    return v_[i];
+}
+
+double BenchSamples::max()
+{
+    return percentile(100);
+}
+
+void BenchSamples::print(const char* name, const char* unit)
+{
+    printf("%s: n=%zu mean=%.2f p50=%.2f p99=%.2f max=%.2f %s\n",
+           name, v_.size(), mean(), percentile(50), percentile(99), max(), unit);
+}
@@ -0,0 +1,171 @@
+#include "dsp_standin.h"
+#include "protocol/helix_protocol.h"
+#include "protocol/helix_packets.h"
+#include <cstring>
+
+DspStandIn& dsp_standin_link_up()
+{
+    static DspStandIn dsp;
+    host_time_virtual(true);
+    helix_begin(dsp);
+    for (int t = 0; t < 1000 && !helix_ready(); t++) {
+        helix_loop();
+        host_time_advance_us(1000);
+    }
+    host_time_virtual(false);
+    return dsp;
+}
+
+DspStandIn::DspStandIn(const DspStandInConfig& cfg)
+    : cfg_(cfg), rng_(cfg.seed), rx_(rx_buf_, sizeof(rx_buf_))
+{
+    parser_.begin(on_frame, this);
+
+    state_.value[DSP_FW_VERSION]   = 0x0102;
+    state_.value[DSP_MASTER_STEPS] = 60;
+    state_.value[DSP_STEP_DB10]    = 5;
+    state_.value[DSP_MASTER_INDEX] = 40;
+}
+
+// ---------------- Controller side ----------------
+void DspStandIn::release()
+{
+    uint32_t now = millis();
+    while (!pending_.empty() && (int32_t)(now - pending_.front().due_ms) >= 0) {
+        for (uint8_t b : pending_.front().bytes) {
+            if (cfg_.byte_loss_pm && rng_() % 1000 < cfg_.byte_loss_pm) {
+                stats_.bytes_lost++;
+                continue;
+            }
+            out_.push_back(b);
+        }
+        pending_.pop_front();
+    }
+}
+
+int DspStandIn::available()
+{
+    release();
+    return (int)out_.size();
+}
+
+int DspStandIn::read()
+{
+    release();
+    if (out_.empty()) return -1;
+    uint8_t b = out_.front();
+    out_.pop_front();
+    return b;
+}
+
+size_t DspStandIn::write(const uint8_t* buf, size_t len)
+{
+    if (millis() < cfg_.boot_ms) return len;    // not powered yet: bytes vanish
+
+    // Parameter writes keep the firmware's original 8-byte layout, whose
+    // len byte (6) does not match the 4-byte payload, so the frame parser
+    // would wait for bytes that never come. They are picked out here by
+    // their header; everything else goes to the parser.
+    static const uint8_t param_hdr[3] = {
+        HELIX_SYNC, HELIX_PARAM_LEN_BYTE, (uint8_t)~HELIX_PARAM_LEN_BYTE
+    };
+
+    in_.insert(in_.end(), buf, buf + len);
+    size_t i = 0;
+    while (i < in_.size()) {
+        size_t left = in_.size() - i;
+        size_t m = left < sizeof(param_hdr) ? left : sizeof(param_hdr);
+        if (memcmp(&in_[i], param_hdr, m) == 0) {
+            if (left < HelixParamPacket::size) break;   // rest still in flight
+            on_param_write(&in_[i]);
+            i += HelixParamPacket::size;
+            continue;
+        }
+
+        // Up to the next sync byte, which might start a parameter write
+        size_t j = i + 1;
+        while (j < in_.size() && in_[j] != HELIX_SYNC) j++;
+        rx_.push(&in_[i], (uint32_t)(j - i));
+        parser_.poll(rx_);
+        i = j;
+    }
+    in_.erase(in_.begin(), in_.begin() + i);
+    return len;
+}
+
+// ---------------- DSP behaviour ----------------
+void DspStandIn::on_frame(const HelixFrame& f, void* ctx)
+{
+    DspStandIn* d = (DspStandIn*)ctx;
+    if (f.group() != 0x2A) return;
+
+    if (f.len == 3 && f.id() == 0x00) {
+        d->stats_.hs0++;
+        uint8_t ready[HELIX_LEN_READY] = { 0x01, 0x2A, 0x00, 0x01 };
+        d->respond(ready, sizeof(ready));
+    } else if (f.len == 3 && f.id() == 0x03) {
+        d->stats_.hs1++;
+        uint8_t payload[HELIX_LEN_BLOB];
+        dsp_blob_encode(d->state_, payload);
+        d->respond(payload, sizeof(payload));
+    }
+}
+
+void DspStandIn::on_param_write(const uint8_t* pkt)
+{
+    uint8_t sum = 0;
+    for (size_t i = 0; i < HelixParamPacket::sum_at; i++)
+        sum += pkt[i];
+    if (sum != pkt[HelixParamPacket::sum_at]) return;
+
+    uint8_t group = pkt[HELIX_PARAM_GROUP_AT];
+    uint8_t id = pkt[HELIX_PARAM_ID_AT];
+    uint8_t value = pkt[HELIX_PARAM_VALUE_AT];
+    if (group == 0x2A && id == 0x04) {
+        stats_.writes++;
+        state_.value[DSP_MASTER_INDEX] = value;
+    }
+    if (cfg_.ack_writes) {
+        uint8_t ack[DSP_STANDIN_ACK_LEN] = { HELIX_DEV_ADDR, group, id, value, 0x06 };
+        respond(ack, sizeof(ack));
+    }
+}
+
+void DspStandIn::respond(const uint8_t* payload, uint8_t len)
+{
+    if (rng_() % 100 < cfg_.drop_pct) {
+        stats_.dropped++;
+        return;
+    }
+
+    std::vector<uint8_t> frame;
+    frame.push_back(HELIX_SYNC);
+    frame.push_back(len);
+    frame.push_back((uint8_t)~len);
+    frame.insert(frame.end(), payload, payload + len);
+    frame.push_back(helix_checksum(frame.data(), len));
+
+    if (rng_() % 100 < cfg_.corrupt_pct) {
+        frame[1 + rng_() % (frame.size() - 1)] ^= 1u << (rng_() % 8);
+        stats_.corrupted++;
+    }
+
+    uint32_t delay_ms = cfg_.latency_ms;
+    if (cfg_.jitter_ms) delay_ms += rng_() % (cfg_.jitter_ms + 1);
+
+    stats_.responses++;
+    pending_.push_back({ millis() + delay_ms, std::move(frame) });
+}
+
+void DspStandIn::restart()
+{
+    pending_.clear();
+    out_.clear();
+    in_.clear();
+    rx_.consume(rx_.size());
+    parser_.reset();
+    cfg_.boot_ms = 0;
+
+    uint8_t ready[HELIX_LEN_READY] = { 0x01, 0x2A, 0x00, 0x01 };
+    respond(ready, sizeof(ready));
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <Arduino.h>
+#include <deque>
+#include <random>
+#include <vector>
+#include "protocol/helix_parser.h"
+#include "protocol/dsp_state.h"
+
+// ---------------- Host DSP stand-in ----------------
+// Plays the DSP end of the Helix link as a HardwareSerial, on the
+// shim's clock (use host_time_virtual() for deterministic runs).
+// Answers HS0 with the ready frame and HS1 with a configuration blob
+// built by dsp_blob_encode(), and applies master volume writes. Faults
+// are per response (powered off until boot_ms, latency plus jitter,
+// random drops, single-byte corruption) and per byte (loss).
+//
+// Input may arrive in any split, as it does over a pty (host/bench/
+// pty_link.h). With ack_writes set, every parameter write is answered
+// with DSP_STANDIN_ACK_LEN bytes: 01 group id value 06. That frame is a
+// stand-in convention for timing round trips, not a known DSP reply;
+// the firmware has no handler for its length and ignores it.
+
+#define DSP_STANDIN_ACK_LEN 5
+
+struct DspStandInConfig {
+    uint32_t boot_ms = 0;           // deaf and mute until millis() reaches this
+    uint32_t latency_ms = 2;        // request → first response byte
+    uint32_t jitter_ms = 0;         // plus 0..jitter_ms, uniform
+    uint32_t drop_pct = 0;          // whole responses
+    uint32_t corrupt_pct = 0;
+    uint32_t byte_loss_pm = 0;      // single response bytes, per mille
+    bool ack_writes = false;
+    uint32_t seed = 1;
+};
+
+struct DspStandInStats {
+    uint32_t hs0, hs1, writes;      // requests understood
+    uint32_t responses, dropped, corrupted;
+    uint32_t bytes_lost;
+};
+
+class DspStandIn;
+
+// Bring helix_protocol up against a clean stand-in on the virtual clock,
+// for benches that need helix_volume_delta() to be accepted
+DspStandIn& dsp_standin_link_up();
+
+class DspStandIn : public HardwareSerial {
+public:
+    explicit DspStandIn(const DspStandInConfig& cfg = {});
+
+    // Controller side (this is what helix_begin() gets)
+    int available() override;
+    int read() override;
+    size_t write(const uint8_t* buf, size_t len) override;
+    using HardwareSerial::write;
+
+    // Test side
+    void restart();                 // power-cycle: announce with an unsolicited ready frame
+    DspState& state() { return state_; }
+    const DspStandInStats& stats() const { return stats_; }
+
+private:
+    struct Pending {
+        uint32_t due_ms;
+        std::vector<uint8_t> bytes;
+    };
+
+    static void on_frame(const HelixFrame& f, void* ctx);
+    void on_param_write(const uint8_t* pkt);
+    void respond(const uint8_t* payload, uint8_t len);
+    void release();
+
+    DspStandInConfig cfg_;
+    std::mt19937 rng_;
+    uint8_t rx_buf_[512];
+    HelixRing rx_;
+    HelixParser parser_;
+    std::vector<uint8_t> in_;       // controller bytes not yet classified
+    std::deque<Pending> pending_;
+    std::deque<uint8_t> out_;
+    DspState state_ = {};
+    DspStandInStats stats_ = {};
+};
@@ -0,0 +1,138 @@
+#include "mem_display.h"
+#include "bench.h"
+#include "display/round_mask.h"
+#include <Arduino.h>
+#include <cstring>
+
+static uint16_t fb[MEM_DISPLAY_W * MEM_DISPLAY_H];
+static uint64_t px_flushed = 0;
+static uint32_t flush_count = 0;
+static uint64_t flush_ns = 0;
+static bool swap_on_flush = !DISPLAY_NATIVE_SWAP;
+static MemRound round_mode = MEM_ROUND_OFF;
+
+static void copy_run(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* px, void*)
+{
+    uint64_t t0 = bench_now_ns();
+
+    for (int32_t r = 0; r < h; r++) {
+        uint16_t* dst = &fb[(y + r) * MEM_DISPLAY_W + x];
+        const uint16_t* src = px + r * w;
+        if (swap_on_flush) {
+            // What pushColors(..., true) does per pixel on the C3
+            for (int32_t i = 0; i < w; i++)
+                dst[i] = (uint16_t)((src[i] << 8) | (src[i] >> 8));
+        } else {
+            memcpy(dst, src, w * sizeof(uint16_t));
+        }
+    }
+
+    flush_ns += bench_now_ns() - t0;
+    px_flushed += (uint64_t)w * h;
+}
+
+static void mem_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* color_p)
+{
+    lv_area_t box = *area;
+    uint16_t* px = (uint16_t*)color_p;
+
+    switch (round_mode) {
+    case MEM_ROUND_SPANS:
+        round_for_each_run(area, px, copy_run, nullptr);
+        break;
+    case MEM_ROUND_BOX:
+        if (round_pack_area(&box, &px))
+            copy_run(box.x1, box.y1, lv_area_get_width(&box), lv_area_get_height(&box), px, nullptr);
+        break;
+    default:
+        copy_run(area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area), px, nullptr);
+        break;
+    }
+
+    flush_count++;
+    lv_display_flush_ready(disp);
+}
+
+static void round_invalidate_cb(lv_event_t* e)
+{
+    round_invalidate_area((lv_area_t*)lv_event_get_param(e));
+}
+
+void bench_lvgl_init()
+{
+    static bool done = false;
+    if (done) return;
+    done = true;
+
+    lv_init();
+    lv_tick_set_cb(millis);
+}
+
+lv_display_t* mem_display_create()
+{
+    bench_lvgl_init();
+
+    lv_display_t* disp = lv_display_create(MEM_DISPLAY_W, MEM_DISPLAY_H);
+    mem_display_set_native_swap(disp, DISPLAY_NATIVE_SWAP);
+
+    static uint16_t buf1[MEM_DISPLAY_W * DISPLAY_BUF_LINES];
+    static uint16_t buf2[MEM_DISPLAY_W * DISPLAY_BUF_LINES];
+
+    lv_display_set_buffers(
+        disp,
+        buf1, buf2,
+        sizeof(buf1),
+        LV_DISPLAY_RENDER_MODE_PARTIAL
+    );
+
+    lv_display_set_flush_cb(disp, mem_flush_cb);
+    mem_display_set_round(disp, !DISPLAY_ROUND_CLIP ? MEM_ROUND_OFF
+                              : DISPLAY_USE_DMA ? MEM_ROUND_BOX : MEM_ROUND_SPANS);
+    return disp;
+}
+
+void mem_display_set_native_swap(lv_display_t* disp, bool native)
+{
+    lv_display_set_color_format(disp, native ? LV_COLOR_FORMAT_RGB565_SWAPPED
+                                             : LV_COLOR_FORMAT_RGB565);
+    swap_on_flush = !native;
+}
+
+void mem_display_set_round(lv_display_t* disp, MemRound mode)
+{
+    bool was = round_mode != MEM_ROUND_OFF;
+    bool on = mode != MEM_ROUND_OFF;
+    round_mode = mode;
+    if (on == was) return;
+    if (on)
+        lv_display_add_event_cb(disp, round_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    else
+        lv_display_remove_event_cb_with_user_data(disp, round_invalidate_cb, NULL);
+}
+
+const uint16_t* mem_display_framebuffer()
+{
+    return fb;
+}
+
+uint64_t mem_display_pixels_flushed()
+{
+    return px_flushed;
+}
+
+uint64_t mem_display_flush_ns()
+{
+    return flush_ns;
+}
+
+uint32_t mem_display_flush_count()
+{
+    return flush_count;
+}
+
+void mem_display_reset_counters()
+{
+    px_flushed = 0;
+    flush_count = 0;
+    flush_ns = 0;
+}
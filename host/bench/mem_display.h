@@ -0,0 +1,34 @@
+#pragma once
+#include <lvgl.h>
+#include <cstdint>
+
+#include "display/display.h"
+
+// Memory-backed LVGL display standing in for my_flush_cb/TFT_eSPI.
+// Same geometry, buffers and color format as display_begin(). Flushed
+// areas land in a framebuffer in panel (big-endian RGB565) byte order,
+// i.e. exactly what would have gone out over SPI.
+
+#define MEM_DISPLAY_W DISPLAY_W
+#define MEM_DISPLAY_H DISPLAY_H
+
+void bench_lvgl_init();
+lv_display_t* mem_display_create();
+
+// Switch between the two DISPLAY_NATIVE_SWAP pipelines at runtime
+void mem_display_set_native_swap(lv_display_t* disp, bool native);
+// How a flushed stripe meets the round glass, as in display.cpp
+enum MemRound {
+    MEM_ROUND_OFF,      // whole stripe (DISPLAY_ROUND_CLIP=0)
+    MEM_ROUND_SPANS,    // exact row spans (my_flush_cb)
+    MEM_ROUND_BOX,      // packed on-glass bounding box (my_flush_dma_cb)
+};
+
+// Default: the path display_begin() would pick for this build
+void mem_display_set_round(lv_display_t* disp, MemRound mode);
+
+const uint16_t* mem_display_framebuffer();
+uint64_t mem_display_flush_ns();
+uint64_t mem_display_pixels_flushed();
+uint32_t mem_display_flush_count();
+void mem_display_reset_counters();
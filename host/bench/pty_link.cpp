@@ -0,0 +1,112 @@
+#include "pty_link.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <cstring>
+
+// ---------------- PtySerial ----------------
+int PtySerial::available()
+{
+    int n = 0;
+    if (fd_ < 0 || ioctl(fd_, FIONREAD, &n) < 0) return 0;
+    return n;
+}
+
+int PtySerial::read()
+{
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+}
+
+size_t PtySerial::read(uint8_t* buf, size_t len)
+{
+    if (fd_ < 0) return 0;
+    ssize_t n = ::read(fd_, buf, len);
+    return n > 0 ? (size_t)n : 0;
+}
+
+size_t PtySerial::write(const uint8_t* buf, size_t len)
+{
+    size_t done = 0;
+    while (fd_ >= 0 && done < len) {
+        ssize_t n = ::write(fd_, buf + done, len - done);
+        if (n > 0) {
+            done += n;
+        } else {
+            // pty buffer full: wait for the other end, like a UART would
+            pollfd p = { fd_, POLLOUT, 0 };
+            if (poll(&p, 1, 100) <= 0) break;
+        }
+    }
+    return done;
+}
+
+// ---------------- pty pair ----------------
+static void make_raw(int fd)
+{
+    termios t;
+    if (tcgetattr(fd, &t) != 0) return;
+    cfmakeraw(&t);
+    tcsetattr(fd, TCSANOW, &t);
+}
+
+int pty_open(char* slave_path, size_t path_len)
+{
+    int m = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (m < 0) return -1;
+    if (grantpt(m) != 0 || unlockpt(m) != 0) {
+        close(m);
+        return -1;
+    }
+    const char* name = ptsname(m);
+    if (!name || strlen(name) >= path_len) {
+        close(m);
+        return -1;
+    }
+    strcpy(slave_path, name);
+
+    // Line settings live on the slave side; a raw slave also stops the
+    // pty echoing the controller's bytes back at it
+    int s = open(slave_path, O_RDWR | O_NOCTTY);
+    if (s >= 0) {
+        make_raw(s);
+        close(s);
+    }
+    return m;
+}
+
+int pty_open_slave(const char* slave_path)
+{
+    int fd = open(slave_path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd >= 0) make_raw(fd);
+    return fd;
+}
+
+// ---------------- DSP side ----------------
+void dsp_sim_serve(int master_fd, const DspStandInConfig& cfg, volatile bool* stop)
+{
+    DspStandIn dsp(cfg);
+    PtySerial line(master_fd);
+    uint8_t buf[256];
+
+    while (!stop || !*stop) {
+        pollfd p = { master_fd, POLLIN, 0 };
+        poll(&p, 1, 1);     // 1 ms: also the resolution of latency/jitter
+        if (p.revents & POLLHUP) {
+            usleep(1000);   // no controller has the slave open yet
+            continue;
+        }
+
+        size_t n;
+        while ((n = line.read(buf, sizeof(buf))) > 0)
+            dsp.write(buf, n);
+
+        n = 0;
+        while (n < sizeof(buf) && dsp.available() > 0)
+            buf[n++] = (uint8_t)dsp.read();
+        if (n) line.write(buf, n);
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <Arduino.h>
+#include "dsp_standin.h"
+
+// ---------------- Pseudo-terminal DSP link ----------------
+// The protocol only sees a HardwareSerial, so on the host that class is
+// the transport: DspStandIn plays the DSP in-process, PtySerial talks to
+// a file descriptor instead. pty_open() makes a raw master/slave pair;
+// dsp_sim_serve() runs a DspStandIn on the master end in real time, so
+// the controller under test can be this process, another process, or
+// anything else that opens the slave path.
+
+class PtySerial : public HardwareSerial {
+public:
+    explicit PtySerial(int fd = -1) : fd_(fd) {}
+    void attach(int fd) { fd_ = fd; }
+    int fd() const { return fd_; }
+
+    int available() override;
+    int read() override;
+    size_t read(uint8_t* buf, size_t len) override;
+    size_t write(const uint8_t* buf, size_t len) override;
+    using HardwareSerial::write;
+
+private:
+    int fd_;
+};
+
+// Raw (no echo, no line discipline) pty. Returns the master fd and the
+// slave path, or -1.
+int pty_open(char* slave_path, size_t path_len);
+
+// Opens a slave path non-blocking, for PtySerial
+int pty_open_slave(const char* slave_path);
+
+// Pumps bytes between `master_fd` and a DspStandIn built from `cfg`
+// until *stop is set (never, when stop is null).
+void dsp_sim_serve(int master_fd, const DspStandInConfig& cfg, volatile bool* stop = nullptr);
@@ -0,0 +1,168 @@
+#include "Arduino.h"
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+HardwareSerial Serial;
+
+// The simulator (host/sim) puts its DSP stand-in here; benches never use it
+static HardwareSerial serial1_unconnected;
+__attribute__((weak)) HardwareSerial& Serial1 = serial1_unconnected;
+
+static const auto t_boot = std::chrono::steady_clock::now();
+static bool virtual_time = false;
+static uint64_t virtual_us = 0;
+
+static uint64_t now_us()
+{
+    if (virtual_time) return virtual_us;
+    auto dt = std::chrono::steady_clock::now() - t_boot;
+    return std::chrono::duration_cast<std::chrono::microseconds>(dt).count();
+}
+
+uint32_t millis()
+{
+    return (uint32_t)(now_us() / 1000);
+}
+
+uint32_t micros()
+{
+    return (uint32_t)now_us();
+}
+
+void delay(uint32_t ms)
+{
+    if (virtual_time)
+        virtual_us += (uint64_t)ms * 1000;
+    else
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void host_time_virtual(bool on)
+{
+    if (on && !virtual_time) virtual_us = now_us();
+    virtual_time = on;
+}
+
+void host_time_advance_us(uint64_t us)
+{
+    virtual_us += us;
+}
+
+uint64_t host_now_us()
+{
+    return now_us();
+}
+
+static host_idle_fn idle_hook = nullptr;
+
+void host_set_idle_hook(host_idle_fn fn)
+{
+    idle_hook = fn;
+}
+
+void host_idle_until(uint64_t until_us, bool (*wake)(), bool asleep)
+{
+    if (idle_hook) {
+        idle_hook(until_us, wake, asleep);
+        return;
+    }
+    uint64_t now = now_us();
+    if (until_us <= now || (wake && wake())) return;
+    if (virtual_time)
+        virtual_us = until_us;
+    else
+        std::this_thread::sleep_for(std::chrono::microseconds(until_us - now));
+}
+
+uint32_t getCpuFrequencyMhz()
+{
+    return 160;
+}
+
+// ---------------- GPIO ----------------
+static uint32_t gpio_levels = 0;
+static uint32_t gpio_masked = 0;
+static void (*gpio_isr[HOST_GPIO_COUNT])() = {};
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    if (pin < HOST_GPIO_COUNT && mode == INPUT_PULLUP) gpio_levels |= 1u << pin;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+    if (pin >= HOST_GPIO_COUNT) return;
+    if (level) gpio_levels |= 1u << pin;
+    else       gpio_levels &= ~(1u << pin);
+}
+
+int digitalRead(uint8_t pin)
+{
+    return pin < HOST_GPIO_COUNT ? (gpio_levels >> pin) & 1 : LOW;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int)
+{
+    if (pin < HOST_GPIO_COUNT) gpio_isr[pin] = isr;     // CHANGE is all the firmware uses
+}
+
+void host_gpio_set(uint8_t pin, int level)
+{
+    if (pin >= HOST_GPIO_COUNT || digitalRead(pin) == !!level) return;
+    digitalWrite(pin, level);
+    if (gpio_isr[pin] && !(gpio_masked & (1u << pin))) gpio_isr[pin]();
+}
+
+uint32_t host_gpio_in()
+{
+    return gpio_levels;
+}
+
+void host_gpio_mask(uint8_t pin, bool masked)
+{
+    if (pin >= HOST_GPIO_COUNT) return;
+    if (masked) gpio_masked |= 1u << pin;
+    else        gpio_masked &= ~(1u << pin);
+}
+
+// ---------------- Serial ----------------
+size_t HardwareSerial::write(const uint8_t* buf, size_t len)
+{
+    if (out_) fwrite(buf, 1, len, out_);
+    return len;
+}
+
+size_t HardwareSerial::read(uint8_t* buf, size_t len)
+{
+    size_t n = 0;
+    while (n < len) {
+        int b = read();
+        if (b < 0) break;
+        buf[n++] = (uint8_t)b;
+    }
+    return n;
+}
+
+size_t HardwareSerial::print(const char* s)
+{
+    return write((const uint8_t*)s, strlen(s));
+}
+
+size_t HardwareSerial::println(const char* s)
+{
+    size_t n = print(s);
+    return n + print("\n");
+}
+
+size_t HardwareSerial::printf(const char* fmt, ...)
+{
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    if (n >= (int)sizeof(buf)) n = sizeof(buf) - 1;
+    return write((const uint8_t*)buf, n);
+}
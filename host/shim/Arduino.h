@@ -0,0 +1,115 @@
+#pragma once
+// Minimal Arduino surface for the native (Linux) builds.
+// What src/ touches: pages and protocol for the benches, and main.cpp,
+// input/ and sched/ for the firmware simulator (host/sim).
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdarg>
+#include <functional>
+
+#define IRAM_ATTR
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+
+// Host only: virtual clock for deterministic runs. Once enabled, time
+// stands still except through host_time_advance_us() (and delay()).
+void host_time_virtual(bool on);
+void host_time_advance_us(uint64_t us);
+
+// Host only: how the firmware's waits pass (ulTaskNotifyTake, light
+// sleep). The hook moves time towards until_us, running whatever the
+// simulator has scheduled, and returns early once wake() is true.
+// Without a hook, virtual time jumps to until_us (or real time sleeps).
+typedef void (*host_idle_fn)(uint64_t until_us, bool (*wake)(), bool asleep);
+void host_set_idle_hook(host_idle_fn fn);
+void host_idle_until(uint64_t until_us, bool (*wake)(), bool asleep = false);
+uint64_t host_now_us();
+
+uint32_t getCpuFrequencyMhz();
+
+// ---------------- GPIO ----------------
+#define LOW          0
+#define HIGH         1
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define CHANGE       0x03
+#define HOST_GPIO_COUNT 32
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+
+// Host only: drive an input pin; runs its interrupt handler on a change
+// unless the pin's interrupt is masked (see driver/gpio.h)
+void host_gpio_set(uint8_t pin, int level);
+uint32_t host_gpio_in();                // all levels, bit per pin (GPIO_IN_REG)
+void host_gpio_mask(uint8_t pin, bool masked);
+
+// ---------------- Serial ----------------
+// Output side, for code that only writes (see log/binlog.h)
+class Print {
+public:
+    virtual ~Print() = default;
+
+    virtual int availableForWrite() { return 128; }
+    virtual size_t write(const uint8_t* buf, size_t len) = 0;
+
+    size_t write(uint8_t b) { return write(&b, 1); }
+};
+
+enum hardwareSerial_error_t {
+    UART_NO_ERROR,
+    UART_BREAK_ERROR,
+    UART_BUFFER_FULL_ERROR,
+    UART_FIFO_OVF_ERROR,
+    UART_FRAME_ERROR,
+    UART_PARITY_ERROR,
+};
+
+#define SERIAL_8N1 0x800001c
+
+typedef std::function<void(void)> OnReceiveCb;
+typedef std::function<void(hardwareSerial_error_t)> OnReceiveErrorCb;
+
+// Byte-stream base shared by the console and the DSP link stand-ins.
+// Configuration calls are accepted and ignored; the receive callback is
+// kept so a simulator can run it the way the UART event task would.
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long, uint32_t = SERIAL_8N1, int8_t = -1, int8_t = -1) {}
+    size_t setRxBufferSize(size_t n) { return n; }
+    bool setRxFIFOFull(uint8_t) { return true; }
+    void onReceive(OnReceiveCb cb, bool = false) { on_receive_ = cb; }
+    void onReceiveError(OnReceiveErrorCb cb) { on_error_ = cb; }
+    void flush() {}
+
+    // Host only: what the UART event task does when bytes are waiting
+    void host_rx_event() { if (on_receive_ && available() > 0) on_receive_(); }
+
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+    virtual size_t read(uint8_t* buf, size_t len);
+    size_t write(const uint8_t* buf, size_t len) override;
+    using Print::write;
+
+    size_t print(const char* s);
+    size_t println(const char* s = "");
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+    // Host only: where text output goes (nullptr = discard)
+    void setOutput(FILE* out) { out_ = out; }
+
+private:
+    FILE* out_ = stdout;
+    OnReceiveCb on_receive_;
+    OnReceiveErrorCb on_error_;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial& Serial1;         // defined by whoever plays the DSP (host/sim)
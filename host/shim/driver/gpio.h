@@ -0,0 +1,26 @@
+#pragma once
+// Host shim: the GPIO driver calls sched/governor.cpp makes around light sleep
+#include <Arduino.h>
+
+typedef int gpio_num_t;
+
+typedef enum {
+    GPIO_INTR_DISABLE,
+    GPIO_INTR_POSEDGE,
+    GPIO_INTR_NEGEDGE,
+    GPIO_INTR_ANYEDGE,
+    GPIO_INTR_LOW_LEVEL,
+    GPIO_INTR_HIGH_LEVEL,
+} gpio_int_type_t;
+
+typedef int esp_err_t;
+#define ESP_OK 0
+
+static inline int gpio_get_level(gpio_num_t pin) { return digitalRead(pin); }
+static inline esp_err_t gpio_intr_disable(gpio_num_t pin) { host_gpio_mask(pin, true); return ESP_OK; }
+static inline esp_err_t gpio_intr_enable(gpio_num_t pin) { host_gpio_mask(pin, false); return ESP_OK; }
+static inline esp_err_t gpio_set_intr_type(gpio_num_t, gpio_int_type_t) { return ESP_OK; }
+
+// Level wake, checked by esp_light_sleep_start()
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type);
+esp_err_t gpio_wakeup_disable(gpio_num_t pin);
@@ -0,0 +1,7 @@
+#pragma once
+// Host shim: UART wake configuration (see esp_sleep.h)
+#include "gpio.h"
+
+typedef int uart_port_t;
+
+static inline esp_err_t uart_set_wakeup_threshold(uart_port_t, int) { return ESP_OK; }
@@ -0,0 +1,103 @@
+#include <freertos/task.h>
+#include <esp_sleep.h>
+
+// ---------------- Task notification ----------------
+// The firmware has one task that waits (loop()); ISRs and callbacks
+// running inside host_idle_until() give it notifications.
+static uint32_t notify_count = 0;
+static int task_tag;
+
+static bool notified()
+{
+    return notify_count > 0;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return &task_tag;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t* woken)
+{
+    notify_count++;
+    if (woken) *woken = pdTRUE;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t)
+{
+    notify_count++;
+    return pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    if (!notify_count && ticks)
+        host_idle_until(host_now_us() + (uint64_t)ticks * 1000, notified);
+
+    uint32_t n = notify_count;
+    if (n) notify_count = clear ? 0 : n - 1;
+    return n;
+}
+
+// ---------------- Light sleep ----------------
+static uint32_t wake_pins = 0;          // bit per pin with a level wake
+static uint32_t wake_high = 0;          // ... that wakes on high
+static bool gpio_wake = false, uart_wake = false, timer_wake = false;
+static uint64_t timer_wake_us = 0;
+static esp_sleep_wakeup_cause_t cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type)
+{
+    wake_pins |= 1u << pin;
+    if (type == GPIO_INTR_HIGH_LEVEL) wake_high |= 1u << pin;
+    else                              wake_high &= ~(1u << pin);
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t pin)
+{
+    wake_pins &= ~(1u << pin);
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup()            { gpio_wake = true; return ESP_OK; }
+esp_err_t esp_sleep_enable_uart_wakeup(int)         { uart_wake = true; return ESP_OK; }
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us)
+{
+    timer_wake = true;
+    timer_wake_us = us;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t)
+{
+    gpio_wake = uart_wake = timer_wake = false;
+    return ESP_OK;
+}
+
+static bool sleep_over()
+{
+    if (gpio_wake && ((~(host_gpio_in() ^ wake_high)) & wake_pins)) {
+        cause = ESP_SLEEP_WAKEUP_GPIO;
+        return true;
+    }
+    if (uart_wake && Serial1.available() > 0) {
+        cause = ESP_SLEEP_WAKEUP_UART;
+        return true;
+    }
+    return false;
+}
+
+esp_err_t esp_light_sleep_start()
+{
+    cause = ESP_SLEEP_WAKEUP_TIMER;
+    uint64_t until = timer_wake ? host_now_us() + timer_wake_us : UINT64_MAX;
+    host_idle_until(until, sleep_over, true);
+    return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause()
+{
+    return cause;
+}
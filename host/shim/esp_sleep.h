@@ -0,0 +1,22 @@
+#pragma once
+// Host shim: light sleep as a host_idle_until() that only GPIO levels,
+// Serial1 RX bytes or the timer end. Unlike the chip, the waking UART
+// bytes are kept.
+#include "driver/gpio.h"
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED,
+    ESP_SLEEP_WAKEUP_ALL,
+    ESP_SLEEP_WAKEUP_TIMER,
+    ESP_SLEEP_WAKEUP_GPIO,
+    ESP_SLEEP_WAKEUP_UART,
+} esp_sleep_source_t;
+
+typedef esp_sleep_source_t esp_sleep_wakeup_cause_t;
+
+esp_err_t esp_sleep_enable_gpio_wakeup();
+esp_err_t esp_sleep_enable_uart_wakeup(int uart);
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us);
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source);
+esp_err_t esp_light_sleep_start();
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
@@ -0,0 +1,15 @@
+#pragma once
+// Host shim: the FreeRTOS surface src/sched uses. One task (loop()), one
+// notification counter; waiting goes through host_idle_until().
+
+#include <Arduino.h>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))    // 1 kHz tick
+#define portYIELD_FROM_ISR() ((void)0)
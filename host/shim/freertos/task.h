@@ -0,0 +1,7 @@
+#pragma once
+#include "FreeRTOS.h"
+
+TaskHandle_t xTaskGetCurrentTaskHandle();
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
@@ -0,0 +1,8 @@
+#pragma once
+// Host shim: cycle counter derived from the (virtual) clock
+#include <Arduino.h>
+
+static inline uint32_t cpu_hal_get_cycle_count()
+{
+    return (uint32_t)(host_now_us() * getCpuFrequencyMhz());
+}
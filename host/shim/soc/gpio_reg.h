@@ -0,0 +1,6 @@
+#pragma once
+// Host shim: GPIO input register read, backed by the shim's pin levels
+#include <Arduino.h>
+
+#define GPIO_IN_REG 0
+#define REG_READ(reg) ((void)(reg), host_gpio_in())
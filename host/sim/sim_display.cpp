@@ -0,0 +1,54 @@
+#include "display/display.h"
+#include "mem_display.h"
+#include "log/lat_trace.h"
+#include "log/perf.h"
+#include <Arduino.h>
+
+// display_begin() for the simulator: the bench's memory-backed panel
+// instead of TFT_eSPI, with the frame bookkeeping main.cpp and the
+// governor read. Per-stripe timing is not modelled: the latency tracer
+// sees FLUSH and FRAME together at the end of the refresh, and of the
+// per-frame counters only AREA is fed.
+
+static DisplayFrameStats report;
+static uint32_t t_last_frame = 0;
+static uint32_t flushes_at_start = 0;
+static uint64_t pixels_at_start = 0;
+
+static void refr_event_cb(lv_event_t* e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        flushes_at_start = mem_display_flush_count();
+        pixels_at_start = mem_display_pixels_flushed();
+        return;
+    }
+    if (mem_display_flush_count() != flushes_at_start) {
+        report.frames++;
+        t_last_frame = micros();
+        lat_trace_mark(LAT_FLUSH);
+        lat_trace_mark(LAT_FRAME);
+        perf_add(PERF_AREA, (uint32_t)(mem_display_pixels_flushed() - pixels_at_start));
+    }
+}
+
+lv_display_t* display_begin()
+{
+    lv_display_t* disp = mem_display_create();
+    lv_display_add_event_cb(disp, refr_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, refr_event_cb, LV_EVENT_REFR_READY, NULL);
+    return disp;
+}
+
+const DisplayFrameStats& display_frame_stats()
+{
+    return report;
+}
+
+void display_report()
+{
+}
+
+uint32_t display_last_frame_us()
+{
+    return t_last_frame;
+}
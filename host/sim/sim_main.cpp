@@ -0,0 +1,336 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include <malloc.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include "bench.h"
+#include "dsp_standin.h"
+#include "input/encoder.h"
+#include "log/lat_trace.h"
+#include "log/perf.h"
+#include "model/params.h"
+#include "pages/master_dial.h"
+#include "protocol/helix_protocol.h"
+
+// ---------------- Firmware simulator ----------------
+// Runs setup()/loop() from src/main.cpp unchanged on the shim's virtual
+// clock. A DspStandIn sits on Serial1; a scripted user turns the knob
+// (quadrature edges through the real ISRs, optional contact bounce),
+// presses the button and walks away long enough for the governor to
+// light-sleep. Time only moves while the firmware waits, plus a fixed
+// SIM_PASS_US per loop() pass, so hours of use replay in seconds to
+// minutes.
+//
+// After every pause the UI, the store, the link and the DSP must agree
+// on the master index; heap use (LVGL pool and process) is sampled on
+// the way to spot leaks and fragmentation. Every latency trace the
+// firmware finishes is collected too, exact and through the firmware's
+// own histogram, so the two can be compared at the end.
+//
+//   pio run -e sim && .pio/build/sim/program [detents] [seed] [bounce%] [-v] [--perf FILE]
+//
+// --perf writes the firmware's perf dump at the end of the run, as the
+// console would send it (tools/perf_view.py FILE).
+
+void setup();
+void loop();
+
+// Must match the pin mapping in src/main.cpp
+#define SIM_PIN_ENC_A   6
+#define SIM_PIN_ENC_B   7
+#define SIM_PIN_ENC_BTN 9
+
+#ifndef SIM_PASS_US
+#define SIM_PASS_US 200             // virtual CPU time per loop() pass
+#endif
+
+#ifndef SIM_REPORT_S
+#define SIM_REPORT_S 3600           // heap/drift line every virtual hour
+#endif
+
+static DspStandIn dsp;
+HardwareSerial& Serial1 = dsp;
+
+// ---------------- Scripted user ----------------
+static std::mt19937 rng;
+static uint32_t bounce_pct = 0;
+
+static uint64_t next_edge_us = UINT64_MAX;
+static int spin_left = 0;           // transitions still to make in this gesture
+static int spin_dir = 1;
+static uint32_t spin_period_us = 0;
+static bool btn_down = false;
+static uint64_t detents_target = 0;
+static uint64_t detents_made = 0;
+static uint64_t pause_end_us = 0;   // > 0: in a pause
+static uint64_t check_at_us = 0;    // > 0: compare state once it settled
+
+#ifndef SIM_SETTLE_MS
+#define SIM_SETTLE_MS 400           // pause → everyone agrees on the index
+#endif
+
+static uint32_t rand_range(uint32_t lo, uint32_t hi)
+{
+    return lo + rng() % (hi - lo + 1);
+}
+
+static void quad_step(int dir)
+{
+    // Gray sequence 00 → 01 → 11 → 10, one pin per step
+    static const uint8_t seq[4] = { 0, 1, 3, 2 };
+    uint8_t state = (digitalRead(SIM_PIN_ENC_A) << 1) | digitalRead(SIM_PIN_ENC_B);
+    int pos = 0;
+    while (seq[pos] != state) pos++;
+    uint8_t next = seq[(pos + dir + 4) % 4];
+    uint8_t pin = ((state ^ next) & 2) ? SIM_PIN_ENC_A : SIM_PIN_ENC_B;
+
+    host_gpio_set(pin, !digitalRead(pin));
+    if (bounce_pct && rng() % 100 < bounce_pct) {
+        // Contact chatter right after the edge: back and forth once
+        host_time_advance_us(20);
+        host_gpio_set(pin, !digitalRead(pin));
+        host_time_advance_us(20);
+        host_gpio_set(pin, !digitalRead(pin));
+    }
+}
+
+static void plan_gesture(uint64_t now)
+{
+    if (detents_made >= detents_target) {
+        next_edge_us = UINT64_MAX;
+        return;
+    }
+
+    uint32_t r = rng() % 100;
+    if (r < 3) {
+        // Button click
+        btn_down = true;
+        host_gpio_set(SIM_PIN_ENC_BTN, LOW);
+        next_edge_us = now + rand_range(80, 300) * 1000;
+        return;
+    }
+
+    spin_left = rand_range(1, 40) * ENC_TRANSITIONS_PER_DETENT;
+    spin_dir = (rng() & 1) ? 1 : -1;
+    spin_period_us = rand_range(3, 150) * 1000 / ENC_TRANSITIONS_PER_DETENT;
+    next_edge_us = now + spin_period_us;
+}
+
+static void run_event(uint64_t now)
+{
+    if (btn_down) {
+        btn_down = false;
+        host_gpio_set(SIM_PIN_ENC_BTN, HIGH);
+    } else if (spin_left > 0) {
+        quad_step(spin_dir);
+        spin_left--;
+        if (spin_left % ENC_TRANSITIONS_PER_DETENT == 0) detents_made++;
+        if (spin_left > 0) {
+            next_edge_us = now + spin_period_us;
+            return;
+        }
+    }
+
+    // Gesture over: pause, mostly short, sometimes long enough to sleep
+    uint32_t pause_ms = rng() % 100 < 5 ? rand_range(25000, 120000) : rand_range(50, 2000);
+    pause_end_us = now + (uint64_t)pause_ms * 1000;
+    check_at_us = pause_ms > SIM_SETTLE_MS ? now + SIM_SETTLE_MS * 1000 : 0;
+    next_edge_us = pause_end_us;
+    spin_left = 0;
+}
+
+static void check_agreement();
+
+static void sim_idle(uint64_t until_us, bool (*wake)(), bool asleep)
+{
+    for (;;) {
+        uint64_t now = host_now_us();
+        if (check_at_us && now >= check_at_us) {
+            check_at_us = 0;
+            check_agreement();      // state only moves inside loop(), not here
+        }
+        while (next_edge_us <= now) {
+            if (pause_end_us && now >= pause_end_us) {
+                pause_end_us = 0;
+                plan_gesture(now);
+            } else {
+                run_event(now);
+            }
+        }
+        if (!asleep) Serial1.host_rx_event();      // UART event task
+        if (wake && wake()) return;
+        if (now >= until_us) return;
+        if (next_edge_us == UINT64_MAX && until_us == UINT64_MAX) return;   // script done
+
+        uint64_t step = now + 1000;                 // DSP responses have 1 ms resolution
+        if (step > until_us) step = until_us;
+        if (step > next_edge_us) step = next_edge_us;
+        if (check_at_us && step > check_at_us) step = check_at_us;
+        host_time_advance_us(step - now);
+    }
+}
+
+// ---------------- Checks ----------------
+struct HeapSample {
+    uint32_t lv_used, lv_frag, lv_biggest_free, lv_max_used;
+    size_t proc_used;
+};
+
+static HeapSample heap_sample()
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    struct mallinfo2 mi = mallinfo2();
+    return { (uint32_t)(mon.total_size - mon.free_size), mon.frag_pct,
+             (uint32_t)mon.free_biggest_size, (uint32_t)mon.max_used, mi.uordblks };
+}
+
+static uint64_t checks = 0, drift = 0;
+
+static void check_agreement()
+{
+    int32_t ui = master_dial_get_value();
+    int32_t store = params_get(&param_master_index);
+    int32_t link = helix_link().master().index;
+    int32_t wire = dsp.state().get(DSP_MASTER_INDEX);
+    checks++;
+    if (ui == store && store == link && link == wire) return;
+
+    if (drift++ < 10)
+        printf("drift at %.1f s: ui=%d store=%d link=%d dsp=%d\n",
+               host_now_us() / 1e6, ui, store, link, wire);
+}
+
+static void report(const char* tag, const HeapSample& h, double wall_s)
+{
+    printf("[%s] t=%.2f h  detents=%llu  checks=%llu drift=%llu  lv used=%u max=%u frag=%u%% big free=%u  heap=%zu  wall=%.1f s\n",
+           tag, host_now_us() / 3.6e9, (unsigned long long)detents_made,
+           (unsigned long long)checks, (unsigned long long)drift,
+           h.lv_used, h.lv_max_used, h.lv_frag, h.lv_biggest_free, h.proc_used, wall_s);
+}
+
+// ---------------- Latency ----------------
+static BenchSamples lat_photon, lat_uart;
+static LogHist hist_photon, hist_uart;
+
+static void on_trace(const LatTrace& t)
+{
+    if (t.has(LAT_FRAME)) {
+        lat_photon.add(t.us(LAT_FRAME));
+        hist_photon.add(t.us(LAT_FRAME));
+    }
+    if (t.has(LAT_TX)) {
+        lat_uart.add(t.us(LAT_TX));
+        hist_uart.add(t.us(LAT_TX));
+    }
+}
+
+static void lat_summary(const char* name, BenchSamples& exact, const LogHist& h)
+{
+    if (!exact.count()) return;
+    exact.print(name, "us");
+    printf("  histogram: p50=%u p99=%u max=%u\n", h.percentile(50), h.percentile(99), h.max());
+}
+
+// ---------------- Perf dump ----------------
+class FilePrint : public Print {
+public:
+    explicit FilePrint(FILE* f) : f_(f) {}
+    size_t write(const uint8_t* buf, size_t len) override { return fwrite(buf, 1, len, f_); }
+
+private:
+    FILE* f_;
+};
+
+// ---------------- Main ----------------
+int main(int argc, char** argv)
+{
+    bool verbose = false;
+    const char* perf_path = nullptr;
+    int pos = 0;
+    uint32_t seed = 1;
+    detents_target = 1000000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) { verbose = true; continue; }
+        if (strcmp(argv[i], "--perf") == 0 && i + 1 < argc) { perf_path = argv[++i]; continue; }
+        switch (pos++) {
+        case 0: detents_target = strtoull(argv[i], nullptr, 10); break;
+        case 1: seed = strtoul(argv[i], nullptr, 10); break;
+        case 2: bounce_pct = strtoul(argv[i], nullptr, 10); break;
+        }
+    }
+    rng.seed(seed);
+
+    Serial.setOutput(verbose ? stdout : nullptr);
+    host_time_virtual(true);
+    host_set_idle_hook(sim_idle);
+    auto wall0 = std::chrono::steady_clock::now();
+    auto wall_s = [&]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - wall0).count();
+    };
+
+    printf("sim: %llu detents, seed %u, bounce %u%%, %u us/pass\n",
+           (unsigned long long)detents_target, seed, bounce_pct, SIM_PASS_US);
+
+    // Up front, so the samples don't show up as heap growth
+    lat_photon.reserve(detents_target);
+    lat_uart.reserve(detents_target);
+
+    setup();
+    lat_trace_set_sink(on_trace);
+    plan_gesture(host_now_us());
+
+    HeapSample first = {};
+    bool have_first = false;
+    uint64_t next_report_us = host_now_us() + (uint64_t)SIM_REPORT_S * 1000000;
+    uint64_t passes = 0;
+
+    while (next_edge_us != UINT64_MAX || spin_left > 0) {
+        host_time_advance_us(SIM_PASS_US);
+        loop();
+        passes++;
+
+        uint64_t now = host_now_us();
+        if (now >= next_report_us) {
+            next_report_us += (uint64_t)SIM_REPORT_S * 1000000;
+            HeapSample h = heap_sample();
+            if (!have_first) { first = h; have_first = true; }
+            report("SIM", h, wall_s());
+        }
+    }
+
+    // Let the last writes land, then a final check
+    uint64_t end = host_now_us() + 2000000;
+    while (host_now_us() < end) {
+        host_time_advance_us(SIM_PASS_US);
+        loop();
+    }
+    check_agreement();
+
+    HeapSample h = heap_sample();
+    double wall = wall_s();
+    report("END", h, wall);
+    printf("passes=%llu  speed-up %.0fx  link: handshakes=%u  dsp writes=%u\n",
+           (unsigned long long)passes, host_now_us() / 1e6 / wall,
+           helix_link_stats().handshakes, dsp.stats().writes);
+    const LatTraceStats& lt = lat_trace_stats();
+    printf("traces: opened=%u done=%u joined=%u dropped=%u coalesced=%u timeouts=%u\n",
+           lt.opened, lt.done, lt.joined, lt.dropped, lt.coalesced, lt.timeouts);
+    lat_summary("edge→photon", lat_photon, hist_photon);
+    lat_summary("edge→uart", lat_uart, hist_uart);
+    if (perf_path) {
+        FILE* f = fopen(perf_path, "wb");
+        if (f) {
+            FilePrint fp(f);
+            perf_dump();
+            while (!perf_empty()) perf_drain(fp);
+            fclose(f);
+        }
+    }
+    if (have_first)
+        printf("since first hour: lv used %+d B, heap %+lld B\n",
+               (int)(h.lv_used - first.lv_used), (long long)h.proc_used - (long long)first.proc_used);
+    return drift ? 1 : 0;
+}
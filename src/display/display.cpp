@@ -0,0 +1,244 @@
+#include <Arduino.h>
+#include "display.h"
+#include "round_mask.h"
+#include "log/lat_trace.h"
+#include "log/perf.h"
+
+// TFT / LVGL order matters!
+#include <TFT_eSPI.h>
+#include <lvgl.h>
+
+#define LV_LVGL_TFT_ESPI_IMPLEMENTATION
+
+// Global display object
+TFT_eSPI tft = TFT_eSPI();
+
+// ---------------- Frame Timing ----------------
+static DisplayFrameStats cur;       // frame in progress
+static DisplayFrameStats win;       // running sums for the report window
+static DisplayFrameStats report;    // last window, averaged
+static uint32_t t_frame_start = 0;
+static uint32_t t_mark = 0;         // CPU resumed rendering here
+static uint32_t t_report = 0;
+static bool report_pending = false;     // a window closed; display_report() prints it
+static uint32_t t_last_frame = 0;   // REFR_READY of the last non-empty frame
+
+static void timing_render_until(uint32_t now)
+{
+    cur.render_us += now - t_mark;
+}
+
+static void timing_blocked(uint32_t t0, uint32_t t1)
+{
+    cur.wait_us += t1 - t0;
+    t_mark = t1;
+}
+
+// `sent` of the stripe's pixels go over SPI; the rest are off glass
+static void timing_stripe(const lv_area_t* area, uint32_t sent)
+{
+    uint32_t all = lv_area_get_width(area) * lv_area_get_height(area);
+
+    cur.stripes++;
+    cur.pixels += sent;
+    cur.clipped += all - sent;
+    cur.xfer_us += (uint32_t)((uint64_t)sent * 16 * 1000000 / SPI_FREQUENCY);
+}
+
+void display_report()
+{
+    if (!report_pending) return;
+    report_pending = false;
+
+    int32_t overlap = (int32_t)(report.render_us + report.xfer_us) - (int32_t)report.frame_us;
+    if (overlap < 0) overlap = 0;
+
+    Serial.printf(
+        "[DISP] %u frames  frame=%uus (max %u)  render=%uus  xfer~%uus  blocked=%uus  overlap=%dus  %u stripes/%u px  %u B off-glass saved\n",
+        report.frames, report.frame_us, report.frame_us_max,
+        report.render_us, report.xfer_us, report.wait_us, overlap,
+        report.stripes, report.pixels, report.clipped * 2);
+}
+
+static void refr_event_cb(lv_event_t* e)
+{
+    uint32_t now = micros();
+
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        cur = {};
+        t_frame_start = t_mark = now;
+        return;
+    }
+
+    // LV_EVENT_REFR_READY
+    if (cur.stripes == 0) return;   // nothing was dirty
+
+    timing_render_until(now);
+    cur.frame_us = now - t_frame_start;
+    t_last_frame = now;
+    lat_trace_mark(LAT_FRAME);
+
+    win.frames++;
+    win.stripes   += cur.stripes;
+    win.pixels    += cur.pixels;
+    win.clipped   += cur.clipped;
+    win.frame_us  += cur.frame_us;
+    win.render_us += cur.render_us;
+    win.wait_us   += cur.wait_us;
+    win.xfer_us   += cur.xfer_us;
+    if (cur.frame_us > win.frame_us_max) win.frame_us_max = cur.frame_us;
+
+    perf_add(PERF_FRAME, cur.frame_us);
+    perf_add(PERF_RENDER, cur.render_us);
+    perf_add(PERF_FLUSH, cur.wait_us);
+    perf_add(PERF_AREA, cur.pixels);
+
+    if (DISPLAY_REPORT_MS && millis() - t_report >= DISPLAY_REPORT_MS) {
+        uint32_t n = win.frames;
+        report = { n, win.stripes / n, win.pixels / n, win.clipped / n, win.frame_us / n,
+                   win.render_us / n, win.wait_us / n, win.xfer_us / n, win.frame_us_max };
+        win = {};
+        t_report = millis();
+        report_pending = true;      // formatted and sent from the loop, not this frame
+    }
+}
+
+// ---------------- Round Clipping ----------------
+#if DISPLAY_ROUND_CLIP
+static void round_invalidate_cb(lv_event_t* e)
+{
+    round_invalidate_area((lv_area_t*)lv_event_get_param(e));
+}
+
+static void send_run(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* px, void*)
+{
+    tft.setAddrWindow(x, y, w, h);
+    tft.pushColors(px, w * h, !DISPLAY_NATIVE_SWAP);
+}
+#endif
+
+// ---------------- Flush ----------------
+void my_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p)
+{
+    uint32_t t0 = micros();
+    timing_render_until(t0);
+
+    tft.startWrite();
+#if DISPLAY_ROUND_CLIP
+    timing_stripe(area, round_visible_px(area));
+    round_for_each_run(area, (uint16_t *)color_p, send_run, nullptr);
+#else
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    timing_stripe(area, w * h);
+    tft.setAddrWindow(area->x1, area->y1, w, h);
+    tft.pushColors((uint16_t *)color_p, w * h, !DISPLAY_NATIVE_SWAP);
+#endif
+    tft.endWrite();
+
+    timing_blocked(t0, micros());
+    lat_trace_mark(LAT_FLUSH);
+    lv_display_flush_ready(disp);
+}
+
+#if DISPLAY_USE_DMA
+// Kick off the transfer and return; LVGL swaps to the other buffer and
+// keeps rendering. flush-ready is signalled from my_flush_wait_cb once
+// the DMA queue has drained. A stripe is always one transfer: with round
+// clipping its on-glass bounding box is packed first (round_pack_area),
+// so the CPU waits at most once, for the previous stripe.
+void my_flush_dma_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p)
+{
+    lv_area_t box = *area;
+    uint16_t* px = (uint16_t *)color_p;
+
+#if DISPLAY_ROUND_CLIP
+    bool visible = round_pack_area(&box, &px);
+#else
+    bool visible = true;
+#endif
+    uint32_t t0 = micros();
+    timing_render_until(t0);        // packing counts as render
+    timing_stripe(area, visible ? lv_area_get_size(&box) : 0);
+
+    if (visible)
+        tft.pushImageDMA(box.x1, box.y1, lv_area_get_width(&box), lv_area_get_height(&box), px);
+
+    timing_blocked(t0, micros());   // pushImageDMA waits for the previous stripe
+    lat_trace_mark(LAT_FLUSH);      // queued: on the wire behind any earlier stripe
+}
+
+// Called by LVGL only when it needs a buffer that is still on the wire
+void my_flush_wait_cb(lv_display_t *disp)
+{
+    uint32_t t0 = micros();
+    timing_render_until(t0);
+
+    tft.dmaWait();
+    lv_display_flush_ready(disp);
+
+    timing_blocked(t0, micros());
+}
+#endif
+
+// ---------------- Init ----------------
+void init_display()
+{
+    tft.init();
+    tft.setRotation(1);
+    tft.fillScreen(TFT_BLACK);
+
+    pinMode(8, OUTPUT);
+    digitalWrite(8, LOW);
+}
+
+lv_display_t* display_begin()
+{
+    // -------- TFT Driver Init (SPI + GC9A01A) --------
+    init_display();
+
+    // -------- LVGL Display Object --------
+    lv_display_t* disp = lv_display_create(DISPLAY_W, DISPLAY_H);
+
+#if DISPLAY_NATIVE_SWAP
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565_SWAPPED);
+#endif
+
+    static uint16_t buf1[DISPLAY_W * DISPLAY_BUF_LINES];
+    static uint16_t buf2[DISPLAY_W * DISPLAY_BUF_LINES];
+
+    lv_display_set_buffers(
+        disp,
+        buf1, buf2,
+        sizeof(buf1),
+        LV_DISPLAY_RENDER_MODE_PARTIAL
+    );
+
+#if DISPLAY_USE_DMA
+    tft.initDMA();
+    tft.setSwapBytes(!DISPLAY_NATIVE_SWAP);
+    tft.startWrite();       // CS held for the DMA path; the panel owns the bus
+    lv_display_set_flush_cb(disp, my_flush_dma_cb);
+    lv_display_set_flush_wait_cb(disp, my_flush_wait_cb);
+#else
+    lv_display_set_flush_cb(disp, my_flush_cb);
+#endif
+
+#if DISPLAY_ROUND_CLIP
+    lv_display_add_event_cb(disp, round_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+#endif
+    lv_display_add_event_cb(disp, refr_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, refr_event_cb, LV_EVENT_REFR_READY, NULL);
+
+    return disp;
+}
+
+const DisplayFrameStats& display_frame_stats()
+{
+    return report;
+}
+
+uint32_t display_last_frame_us()
+{
+    return t_last_frame;
+}
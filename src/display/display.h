@@ -0,0 +1,70 @@
+#pragma once
+#include <lvgl.h>
+
+// ---------------- Display pipeline (TFT_eSPI + LVGL) ----------------
+// 240x240 GC9A01 driven through two 40-line partial buffers.
+//
+// DISPLAY_USE_DMA 1: my_flush_cb starts an SPI DMA transfer and returns
+// immediately; LVGL renders the next stripe into the other buffer while
+// this one is on the wire, and only blocks in the flush-wait callback
+// if it catches up with the transfer. 0 = blocking pushColors().
+
+#ifndef DISPLAY_USE_DMA
+#define DISPLAY_USE_DMA 1
+#endif
+
+// DISPLAY_NATIVE_SWAP 1: LVGL renders straight into the panel's byte
+// order (LV_COLOR_FORMAT_RGB565_SWAPPED) and the flush is a plain copy.
+// 0: LVGL renders little-endian RGB565 and TFT_eSPI swaps every pixel.
+
+#ifndef DISPLAY_NATIVE_SWAP
+#define DISPLAY_NATIVE_SWAP 1
+#endif
+
+// DISPLAY_ROUND_CLIP 1: the panel is a disc. Invalidated areas shrink to
+// their on-glass bounding box. The blocking flush sends only on-glass
+// row spans; the DMA flush sends each stripe's on-glass bounding box as
+// one transfer (see round_mask.h). The box is the full width for every
+// stripe that reaches the disc's middle rows, so on a full frame the DMA
+// flush saves ~10% of the SPI bytes against ~21% for the spans; most of
+// the win is in small invalidations near the rim, which shrink to the
+// glass before LVGL renders them (host bench: round).
+// 0 = treat the panel as the full square.
+
+#ifndef DISPLAY_ROUND_CLIP
+#define DISPLAY_ROUND_CLIP 1
+#endif
+
+#ifndef DISPLAY_REPORT_MS
+#define DISPLAY_REPORT_MS 5000      // 0 = no periodic timing report
+#endif
+
+#define DISPLAY_W 240
+#define DISPLAY_H 240
+#define DISPLAY_BUF_LINES 40
+
+// Per-frame timing, averaged over the last report window
+struct DisplayFrameStats {
+    uint32_t frames;        // refreshes that flushed at least one stripe
+    uint32_t stripes;
+    uint32_t pixels;        // sent over SPI
+    uint32_t clipped;       // rendered but off glass, not sent
+    uint32_t frame_us;      // REFR_START → REFR_READY
+    uint32_t render_us;     // CPU busy rendering
+    uint32_t wait_us;       // CPU blocked on SPI (no overlap left)
+    uint32_t xfer_us;       // estimated wire time at SPI_FREQUENCY
+    uint32_t frame_us_max;
+};
+
+lv_display_t* display_begin();
+
+#ifdef __cplusplus     // also read from C (dial_ring_sprite.c) for the byte order
+const DisplayFrameStats& display_frame_stats();
+#endif
+
+// Print the [DISP] line if a report window closed since the last call.
+// Called from loop(): the frame that closes a window only takes note.
+void display_report();
+
+// micros() at the end of the last refresh that flushed anything
+uint32_t display_last_frame_us();
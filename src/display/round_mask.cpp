@@ -0,0 +1,138 @@
+#include "round_mask.h"
+#include <string.h>
+
+// ---------------- Compile-time row table ----------------
+// Work in half-pixel units so everything stays integer: a pixel centre is
+// at 2x+1, the disc centre at DISPLAY_W, and "touches the disc" means the
+// centre lies within R + 0.5px, i.e. (2x+1-W)^2 + (2y+1-H)^2 <= (W+1)^2.
+struct RoundTable {
+    RoundSpan rows[DISPLAY_H];
+
+    constexpr RoundTable() : rows()
+    {
+        const int32_t r2 = (DISPLAY_W + 1) * (DISPLAY_W + 1);
+        for (int32_t y = 0; y < DISPLAY_H; y++) {
+            int32_t dy = 2 * y + 1 - DISPLAY_H;
+            int32_t x = 0;
+            while (x < DISPLAY_W / 2) {
+                int32_t dx = 2 * x + 1 - DISPLAY_W;
+                if (dx * dx + dy * dy <= r2) break;
+                x++;
+            }
+            rows[y].x1 = (uint8_t)x;
+            rows[y].x2 = (uint8_t)(DISPLAY_W - 1 - x);
+        }
+    }
+};
+
+static constexpr RoundTable table;
+
+static_assert(table.rows[DISPLAY_H / 2].x1 == 0, "disc must touch the left edge at mid height");
+static_assert(table.rows[0].x1 > 0 && table.rows[0].x1 < DISPLAY_W / 2, "top row is a short chord");
+
+const RoundSpan& round_row(int32_t y)
+{
+    return table.rows[y];
+}
+
+// Row span of area row y clipped to glass; false if empty
+static inline bool row_span(const lv_area_t* a, int32_t y, int32_t* x1, int32_t* x2)
+{
+    const RoundSpan& s = table.rows[y];
+    *x1 = a->x1 > s.x1 ? a->x1 : s.x1;
+    *x2 = a->x2 < s.x2 ? a->x2 : s.x2;
+    return *x1 <= *x2;
+}
+
+bool round_clip_area(lv_area_t* area)
+{
+    int32_t y1 = -1, y2 = -1;
+    int32_t bx1 = DISPLAY_W, bx2 = -1;
+
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        int32_t x1, x2;
+        if (!row_span(area, y, &x1, &x2)) continue;
+        if (y1 < 0) y1 = y;
+        y2 = y;
+        if (x1 < bx1) bx1 = x1;
+        if (x2 > bx2) bx2 = x2;
+    }
+
+    if (y1 < 0) return false;
+
+    area->x1 = bx1;
+    area->x2 = bx2;
+    area->y1 = y1;
+    area->y2 = y2;
+    return true;
+}
+
+void round_invalidate_area(lv_area_t* area)
+{
+    if (round_clip_area(area)) return;
+
+    int32_t y = LV_CLAMP(area->y1, DISPLAY_H / 2, area->y2);
+    const RoundSpan& s = table.rows[y];
+    int32_t x = area->x2 < s.x1 ? s.x1 : s.x2;
+    area->x1 = area->x2 = x;
+    area->y1 = area->y2 = y;
+}
+
+uint32_t round_visible_px(const lv_area_t* area)
+{
+    uint32_t n = 0;
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        int32_t x1, x2;
+        if (row_span(area, y, &x1, &x2)) n += x2 - x1 + 1;
+    }
+    return n;
+}
+
+void round_for_each_run(const lv_area_t* area, uint16_t* px,
+                        round_run_cb cb, void* ctx)
+{
+    int32_t w = area->x2 - area->x1 + 1;
+    int32_t run_y = -1;     // start of a pending run of unclipped rows
+
+    for (int32_t y = area->y1; y <= area->y2 + 1; y++) {
+        int32_t x1 = 0, x2 = -1;
+        bool full = y <= area->y2 && row_span(area, y, &x1, &x2)
+                    && x1 == area->x1 && x2 == area->x2;
+
+        if (full) {
+            if (run_y < 0) run_y = y;
+            continue;
+        }
+
+        if (run_y >= 0) {
+            cb(area->x1, run_y, w, y - run_y, px + (run_y - area->y1) * w, ctx);
+            run_y = -1;
+        }
+
+        if (y <= area->y2 && x1 <= x2)
+            cb(x1, y, x2 - x1 + 1, 1, px + (y - area->y1) * w + (x1 - area->x1), ctx);
+    }
+}
+
+bool round_pack_area(lv_area_t* area, uint16_t** px)
+{
+    lv_area_t box = *area;
+    if (!round_clip_area(&box)) return false;
+
+    int32_t w = area->x2 - area->x1 + 1;
+    int32_t bw = box.x2 - box.x1 + 1;
+    uint16_t* src = *px + (box.y1 - area->y1) * w + (box.x1 - area->x1);
+
+    if (bw == w) {
+        *px = src;          // rows already adjacent
+    } else {
+        uint16_t* dst = *px;
+        for (int32_t y = box.y1; y <= box.y2; y++) {
+            memmove(dst, src, bw * sizeof(uint16_t));   // dst never passes src
+            dst += bw;
+            src += w;
+        }
+    }
+    *area = box;
+    return true;
+}
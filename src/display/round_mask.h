@@ -0,0 +1,44 @@
+#pragma once
+#include <lvgl.h>
+#include <stdint.h>
+#include "display.h"
+
+// ---------------- Round panel mask (GC9A01) ----------------
+// The glass is a 240px disc, so ~21% of the square is never visible.
+// A per-row table of on-glass [x1, x2] spans is built at compile time;
+// a pixel counts as on glass if any part of it touches the disc.
+
+struct RoundSpan {
+    uint8_t x1, x2;     // inclusive
+};
+
+const RoundSpan& round_row(int32_t y);
+
+// Shrink an area to the bounding box of its on-glass part.
+// Returns false (area untouched) if none of it is visible.
+bool round_clip_area(lv_area_t* area);
+
+// Body of the LV_EVENT_INVALIDATE_AREA handler: round_clip_area(), and
+// an area entirely off glass becomes the on-glass pixel beside it. The
+// event can't cancel an invalidation and LVGL can't refresh an empty
+// area, so one pixel of render is the cheapest way to drop it.
+void round_invalidate_area(lv_area_t* area);
+
+// Pixels of an area that are actually on glass
+uint32_t round_visible_px(const lv_area_t* area);
+
+// Walk the on-glass part of a rendered area as SPI-sized rectangles:
+// runs of rows the disc doesn't clip go out as one block, clipped rows
+// go out one span at a time. px always points at w*h contiguous pixels.
+typedef void (*round_run_cb)(int32_t x, int32_t y, int32_t w, int32_t h,
+                             uint16_t* px, void* ctx);
+
+void round_for_each_run(const lv_area_t* area, uint16_t* px,
+                        round_run_cb cb, void* ctx);
+
+// Shrink a rendered area to its on-glass bounding box and move those
+// rows together in place, so it can go out as a single block (one DMA
+// transfer). Corners inside the box are still sent. On return *px
+// points at w*h contiguous pixels of the new *area. False if nothing is
+// visible (area and pixels untouched).
+bool round_pack_area(lv_area_t* area, uint16_t** px);
@@ -0,0 +1,86 @@
+#include "encoder.h"
+
+// ---------------- Gray Code Table ----------------
+const int8_t enc_transition_table[4][4] = {
+    {  0, -1, +1,  0 },
+    { +1,  0,  0, -1 },
+    { -1,  0,  0, +1 },
+    {  0, +1, -1,  0 }
+};
+
+// A pause this long starts a new gesture at ×1
+#define ENC_GESTURE_GAP_US 250000
+
+void EncoderDecoder::begin(uint8_t initial_state, EncAccel accel)
+{
+    accel_ = accel;
+    prev_state_ = initial_state & 3;
+    sub_ = 0;
+    last_dir_ = 0;
+    last_t_us_ = 0;
+    last_ccount_ = 0;
+    v_ = 0;
+    invalid_ = 0;
+}
+
+int EncoderDecoder::detent(int dir, uint32_t t_us)
+{
+    uint32_t dt = t_us - last_t_us_;
+    last_t_us_ = t_us;
+
+    if (dir != last_dir_ || dt >= ENC_GESTURE_GAP_US || dt == 0) {
+        // Reversal or fresh gesture: no history to trust
+        last_dir_ = dir;
+        v_ = 0;
+        return dir;
+    }
+
+    // Instantaneous detents/s, smoothed 1:3 so one fast pair can't spike it
+    uint32_t inst = 1000000u / dt;
+    if (inst > 0xFFFF) inst = 0xFFFF;
+    v_ = v_ ? (uint16_t)((v_ * 3u + inst) / 4u) : (uint16_t)inst;
+
+    int mult = 1;
+    if (v_ >= accel_.v_hi) {
+        mult = accel_.max_mult;
+    } else if (v_ > accel_.v_lo) {
+        mult = 1 + (accel_.max_mult - 1) * (v_ - accel_.v_lo) / (accel_.v_hi - accel_.v_lo);
+    }
+    return dir * mult;
+}
+
+int EncoderDecoder::feed(const EncEvent& ev)
+{
+    uint8_t state = ev.state & 3;
+    int8_t step = enc_transition_table[prev_state_][state];
+
+    // Both bits flipped: a transition was lost, direction unknown
+    if (step == 0 && state != prev_state_) invalid_++;
+    prev_state_ = state;
+    if (step == 0) return 0;
+
+    // A step against the partial count cancels it (bounce / jitter)
+    if ((sub_ > 0 && step < 0) || (sub_ < 0 && step > 0)) sub_ = 0;
+    sub_ += step;
+
+    if (sub_ >= ENC_TRANSITIONS_PER_DETENT) {
+        sub_ = 0;
+        last_ccount_ = ev.ccount;
+        return detent(+1, ev.t_us);
+    }
+    if (sub_ <= -ENC_TRANSITIONS_PER_DETENT) {
+        sub_ = 0;
+        last_ccount_ = ev.ccount;
+        return detent(-1, ev.t_us);
+    }
+    return 0;
+}
+
+int EncoderDecoder::poll(EncoderRing& ring)
+{
+    int delta = 0;
+    EncEvent ev;
+    while (ring.pop(&ev))
+        delta += feed(ev);
+    return delta;
+}
@@ -0,0 +1,174 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// ---------------- Quadrature encoder ----------------
+// The ISR pushes every A/B transition with a timestamp into a lock-free
+// single-producer/single-consumer ring. loop() drains it through the
+// decoder, which turns transitions into detents, tracks detent velocity
+// and applies an acceleration curve. The decoder never touches hardware,
+// so it runs on host against synthetic traces.
+
+// Gray-code step for [prev_state][state], state = (A << 1) | B
+extern const int8_t enc_transition_table[4][4];
+
+#ifndef ENC_TRANSITIONS_PER_DETENT
+#define ENC_TRANSITIONS_PER_DETENT 1    // 1 = every valid transition is a step (legacy behaviour)
+#endif
+
+#define ENC_RING_SIZE 64                // power of two
+
+#ifndef ENC_GLITCH_US
+#define ENC_GLITCH_US 200               // same-channel edges closer than this are bounce
+#endif
+
+struct EncEvent {
+    uint32_t t_us;
+    uint8_t  state;
+    uint32_t ccount;    // cycle counter at the edge (latency tracing)
+};
+
+class EncoderRing {
+public:
+    // ISR side
+    bool push(uint32_t t_us, uint8_t state, uint32_t ccount = 0)
+    {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) >= ENC_RING_SIZE) {
+            dropped_++;
+            return false;
+        }
+        ev_[head & (ENC_RING_SIZE - 1)] = { t_us, state, ccount };
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // loop() side
+    bool pop(EncEvent* out)
+    {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) return false;
+        *out = ev_[tail & (ENC_RING_SIZE - 1)];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    uint32_t dropped() const { return dropped_; }
+
+private:
+    EncEvent ev_[ENC_RING_SIZE];
+    std::atomic<uint32_t> head_{0};
+    std::atomic<uint32_t> tail_{0};
+    volatile uint32_t dropped_ = 0;
+};
+
+// ---------------- ISR edge filter ----------------
+// Runs inside the ISR on a single snapshot of both pins and a cycle-counter
+// timestamp. Rejects edges that did not change the state, double jumps
+// (both bits flipped = a missed transition), and re-toggles of the same
+// channel within ENC_GLITCH_US of its last accepted edge (contact bounce).
+// Real rotation alternates A and B, so it never trips the bounce check.
+
+struct EncIsrStats {
+    uint32_t edges;
+    uint32_t accepted;
+    uint32_t rej_nochange;
+    uint32_t rej_invalid;
+    uint32_t rej_bounce;
+    uint32_t cycles_max;        // longest ISR
+    uint64_t cycles_total;
+};
+
+class EncoderFilter {
+public:
+    void begin(uint8_t initial_state, uint32_t cycles_per_us, uint32_t glitch_us = ENC_GLITCH_US)
+    {
+        state_ = initial_state & 3;
+        glitch_cycles_ = glitch_us * cycles_per_us;
+        last_edge_[0] = last_edge_[1] = 0;
+        stats_ = {};
+    }
+
+    // Returns true if the state should go to the ring. Invalid jumps
+    // are passed through (uncounted as accepted) so the decoder resyncs.
+    inline __attribute__((always_inline)) bool edge(uint8_t state, uint32_t ccount)
+    {
+        stats_.edges++;
+        uint8_t changed = state ^ state_;
+
+        if (changed == 0) {
+            stats_.rej_nochange++;
+            return false;
+        }
+        if (changed == 3) {
+            stats_.rej_invalid++;
+            state_ = state;
+            return true;
+        }
+
+        uint8_t ch = changed >> 1;      // 1 = A, 0 = B
+        if (ccount - last_edge_[ch] < glitch_cycles_) {
+            stats_.rej_bounce++;
+            return false;
+        }
+
+        last_edge_[ch] = ccount;
+        state_ = state;
+        stats_.accepted++;
+        return true;
+    }
+
+    inline __attribute__((always_inline)) void isr_cycles(uint32_t cycles)
+    {
+        stats_.cycles_total += cycles;
+        if (cycles > stats_.cycles_max) stats_.cycles_max = cycles;
+    }
+
+    const EncIsrStats& stats() const { return stats_; }
+
+private:
+    uint8_t  state_ = 0;
+    uint32_t glitch_cycles_ = 0;
+    uint32_t last_edge_[2] = {};
+    EncIsrStats stats_ = {};
+};
+
+// Acceleration curve: ×1 below v_lo detents/s, ramping linearly to
+// ×max_mult at v_hi and above
+struct EncAccel {
+    uint16_t v_lo;
+    uint16_t v_hi;
+    uint8_t  max_mult;
+};
+
+#define ENC_ACCEL_DEFAULT { 10, 60, 8 }
+#define ENC_ACCEL_OFF     { 0xFFFF, 0xFFFF, 1 }
+
+class EncoderDecoder {
+public:
+    void begin(uint8_t initial_state, EncAccel accel = ENC_ACCEL_DEFAULT);
+    void setAccel(EncAccel accel) { accel_ = accel; }
+
+    // Drain the ring; returns the accelerated step count since last call
+    int poll(EncoderRing& ring);
+
+    // Feed one transition directly (what poll() does per event)
+    int feed(const EncEvent& ev);
+
+    uint16_t velocity() const { return v_; }    // detents/s, smoothed
+    uint32_t last_detent_us() const { return last_t_us_; }
+    uint32_t last_detent_cycles() const { return last_ccount_; }
+    uint32_t invalid() const { return invalid_; }
+
+private:
+    int detent(int dir, uint32_t t_us);
+
+    EncAccel accel_ = ENC_ACCEL_DEFAULT;
+    uint8_t  prev_state_ = 0;
+    int8_t   sub_ = 0;          // transitions toward the next detent
+    int8_t   last_dir_ = 0;
+    uint32_t last_t_us_ = 0;
+    uint32_t last_ccount_ = 0;
+    uint16_t v_ = 0;
+    uint32_t invalid_ = 0;      // double-step jumps (missed transition)
+};
@@ -0,0 +1,102 @@
+#include "binlog.h"
+#include "protocol/helix_ring.h"
+
+static_assert(BL_COUNT <= 256, "message id is one byte");
+static_assert((BINLOG_RING_SIZE & (BINLOG_RING_SIZE - 1)) == 0, "ring size must be a power of two");
+
+static uint8_t ring_buf[BINLOG_RING_SIZE];
+static HelixRing ring(ring_buf, sizeof(ring_buf));
+static BinlogStats stats;
+static uint32_t unreported_drops = 0;
+
+// ---------------- Encoding ----------------
+// Worst case: sync, len, id, 5-byte time, 5 bytes per argument
+#define BINLOG_MAX_RECORD (3 + 5 + 5 * BINLOG_MAX_ARGS)
+
+static uint8_t* put_varint(uint8_t* p, uint32_t v)
+{
+    while (v >= 0x80) {
+        *p++ = (uint8_t)v | 0x80;
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+static uint32_t zigzag(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static bool enqueue(BinlogMsg id, const int32_t* args, uint8_t n)
+{
+    uint8_t rec[BINLOG_MAX_RECORD];
+    uint8_t* p = rec + 2;
+    *p++ = id;
+    p = put_varint(p, millis());
+    for (uint8_t i = 0; i < n; i++)
+        p = put_varint(p, zigzag(args[i]));
+
+    uint32_t len = p - rec;
+    rec[0] = BINLOG_SYNC;
+    rec[1] = (uint8_t)(len - 2);
+
+    // All or nothing: the drain relies on whole records
+    if (ring.space() < len) return false;
+    ring.push(rec, len);
+    return true;
+}
+
+// ---------------- Public API ----------------
+void binlog_write(BinlogMsg id, const int32_t* args, uint8_t n)
+{
+    if (unreported_drops) {
+        int32_t d = (int32_t)unreported_drops;
+        if (!enqueue(BL_LOG_DROPPED, &d, 1)) {
+            unreported_drops++;
+            stats.dropped++;
+            return;
+        }
+        unreported_drops = 0;
+    }
+
+    if (!enqueue(id, args, n)) {
+        unreported_drops++;
+        stats.dropped++;
+        return;
+    }
+    stats.records++;
+}
+
+void binlog_drain(Print& out)
+{
+    for (;;) {
+        uint32_t queued = ring.size();
+        if (queued < 2) return;
+
+        uint32_t len = 2 + ring.peek(1);
+        if ((uint32_t)out.availableForWrite() < len) return;
+
+        // A record may wrap the end of the ring: at most two spans
+        uint32_t done = 0;
+        while (done < len) {
+            uint32_t span;
+            const uint8_t* p = ring.read_span(done, &span);
+            if (span > len - done) span = len - done;
+            out.write(p, span);
+            done += span;
+        }
+        ring.consume(len);
+        stats.bytes_out += len;
+    }
+}
+
+bool binlog_empty()
+{
+    return ring.size() == 0;
+}
+
+const BinlogStats& binlog_stats()
+{
+    return stats;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+#include "binlog_msgs.h"
+
+// ---------------- Binary logger ----------------
+// BLOG(NAME, args...) appends a few bytes to a RAM ring instead of
+// formatting text; binlog_drain() copies whole records to the console
+// only when loop() is about to sleep and only as much as the port takes
+// without blocking. Messages above BINLOG_LEVEL compile to nothing.
+//
+// Record on the wire (decoded by tools/binlog_decode.py):
+//   0xB1  len  id  varint(millis)  zigzag-varint(arg)...
+// len counts the bytes after itself. 0xB1 never occurs in the ASCII
+// text the periodic reports still print, so both share one port.
+//
+// Single producer: log only from the loop task, never from an ISR.
+
+#define BINLOG_ERROR 1
+#define BINLOG_WARN  2
+#define BINLOG_INFO  3
+#define BINLOG_DEBUG 4
+
+#ifndef BINLOG_LEVEL
+#define BINLOG_LEVEL BINLOG_INFO
+#endif
+
+#ifndef BINLOG_RING_SIZE
+#define BINLOG_RING_SIZE 1024       // power of two
+#endif
+
+#define BINLOG_SYNC     0xB1
+#define BINLOG_MAX_ARGS 6
+
+enum BinlogMsg : uint8_t {
+#define X(name, level, fmt) BL_##name,
+    BINLOG_MESSAGES(X)
+#undef X
+    BL_COUNT
+};
+
+static constexpr uint8_t binlog_level[] = {
+#define X(name, level, fmt) BINLOG_##level,
+    BINLOG_MESSAGES(X)
+#undef X
+};
+
+struct BinlogStats {
+    uint32_t records;       // queued
+    uint32_t dropped;       // ring full at the time of the call
+    uint32_t bytes_out;     // drained to the console
+};
+
+void binlog_write(BinlogMsg id, const int32_t* args, uint8_t n);
+
+// Write queued records to `out` while it has room; never blocks
+void binlog_drain(Print& out);
+
+bool binlog_empty();
+const BinlogStats& binlog_stats();
+
+template <typename... A>
+inline void binlog_emit(BinlogMsg id, A... a)
+{
+    const int32_t args[] = { 0, (int32_t)a... };
+    static_assert(sizeof...(A) <= BINLOG_MAX_ARGS, "too many BLOG arguments");
+    binlog_write(id, args + 1, sizeof...(A));
+}
+
+#define BLOG(name, ...)                                                     \
+    do {                                                                    \
+        if (binlog_level[BL_##name] <= BINLOG_LEVEL)                        \
+            binlog_emit(BL_##name, ##__VA_ARGS__);                          \
+    } while (0)
@@ -0,0 +1,23 @@
+#pragma once
+
+// ---------------- Binary log message table ----------------
+// X(name, level, format). The firmware only keeps the numeric id and the
+// level; tools/binlog_decode.py reads this file for the format strings.
+// Arguments are integers. %D prints a value in tenths as "-12.5".
+//
+// Append only: ids are positions in this list, and logs captured with an
+// older build decode against the table they were written with.
+
+#define BINLOG_MESSAGES(X) \
+    X(LOG_DROPPED,    WARN,  "[LOG] %u records dropped (ring full)") \
+    X(HELIX_HS_START, INFO,  "[HELIX] starting handshake") \
+    X(HELIX_READY,    INFO,  "[HELIX] READY after %u ms (%u packets, %u timeouts)") \
+    X(HELIX_BLOB,     INFO,  "[HELIX] blob received (%u bytes)") \
+    X(VOL_IGNORED,    WARN,  "[HELIX] volume ignored (not ready)") \
+    X(VOL_SET,        DEBUG, "[VOL] idx=%d  db=%D") \
+    X(DIAL_VALUE,     DEBUG, "Master Dial: %d") \
+    X(BUTTON_DOWN,    INFO,  "Button: PRESSED") \
+    X(BUTTON_UP,      INFO,  "Button: RELEASED") \
+    X(HELIX_HS_TIMEOUT, WARN, "[HELIX] HS%u timeout (try %u, waited %u ms)") \
+    X(HELIX_RESYNC,   INFO,  "[HELIX] DSP restarted, config re-read in %u ms") \
+    X(LAT_EVENT,      DEBUG, "[LAT] #%u  loop=%dus model=%dus flush=%dus frame=%dus tx=%dus")
@@ -0,0 +1,123 @@
+#include "lat_trace.h"
+#include "binlog.h"
+#include <hal/cpu_hal.h>
+
+// ---------------- Tracer ----------------
+static uint32_t cycles_per_us = 160;
+static LatTrace cur;
+static bool trace_open = false;
+static bool last_open_joined = false;
+static uint16_t next_id = 0;
+static LogHist hist[LAT_STAGES];
+static LatTraceStats stats;
+static void (*sink_fn)(const LatTrace&) = nullptr;
+
+// Stage that has to be stamped first
+static const LatStage prereq[LAT_STAGES] = {
+    LAT_EDGE, LAT_EDGE, LAT_LOOP, LAT_MODEL, LAT_INVAL, LAT_FLUSH, LAT_MODEL
+};
+
+int32_t LatTrace::us(LatStage s) const
+{
+    if (!has(s)) return -1;
+    return (int32_t)((cycles[s] - cycles[LAT_EDGE]) / cycles_per_us);
+}
+
+static void finish()
+{
+    for (int s = LAT_LOOP; s < LAT_STAGES; s++)
+        if (cur.has((LatStage)s)) hist[s].add(cur.us((LatStage)s));
+
+    BLOG(LAT_EVENT, cur.id, cur.us(LAT_LOOP), cur.us(LAT_MODEL),
+         cur.us(LAT_FLUSH), cur.us(LAT_FRAME), cur.us(LAT_TX));
+    if (sink_fn) sink_fn(cur);
+
+    stats.done++;
+    trace_open = false;
+}
+
+void lat_trace_begin(uint32_t cpu_mhz)
+{
+    cycles_per_us = cpu_mhz ? cpu_mhz : 1;
+    trace_open = false;
+    stats = {};
+    lat_trace_reset_hist();
+}
+
+void lat_trace_open(uint32_t edge_cycles, bool want_tx)
+{
+    uint32_t now = cpu_hal_get_cycle_count();
+
+    if (trace_open && now - cur.cycles[LAT_EDGE] > (uint32_t)LAT_TRACE_TIMEOUT_MS * 1000 * cycles_per_us) {
+        stats.timeouts++;
+        if (cur.has(LAT_FRAME)) finish();   // keep the photon sample, TX never came
+        else trace_open = false;
+    }
+    if (trace_open) {
+        cur.joined++;
+        stats.joined++;
+        last_open_joined = true;
+        return;
+    }
+
+    cur = {};
+    cur.id = next_id++;
+    cur.want_tx = want_tx;
+    cur.cycles[LAT_EDGE] = edge_cycles;
+    cur.cycles[LAT_LOOP] = now;
+    cur.stamped = (1u << LAT_EDGE) | (1u << LAT_LOOP);
+    trace_open = true;
+    last_open_joined = false;
+    stats.opened++;
+}
+
+void lat_trace_drop()
+{
+    if (!trace_open) return;
+    if (last_open_joined) {
+        cur.joined--;
+        stats.joined--;
+        return;
+    }
+    stats.dropped++;
+    trace_open = false;
+}
+
+void lat_trace_mark(LatStage s)
+{
+    if (!trace_open || cur.has(s) || !cur.has(prereq[s])) return;
+
+    cur.cycles[s] = cpu_hal_get_cycle_count();
+    cur.stamped |= 1u << s;
+
+    if (cur.has(LAT_FRAME) && (cur.has(LAT_TX) || !cur.want_tx)) finish();
+}
+
+void lat_trace_tx_coalesced()
+{
+    if (!trace_open || !cur.want_tx || cur.has(LAT_TX)) return;
+
+    cur.want_tx = false;
+    stats.coalesced++;
+    if (cur.has(LAT_FRAME)) finish();
+}
+
+const LogHist& lat_trace_hist(LatStage s)
+{
+    return hist[s];
+}
+
+void lat_trace_reset_hist()
+{
+    for (LogHist& h : hist) h.clear();
+}
+
+const LatTraceStats& lat_trace_stats()
+{
+    return stats;
+}
+
+void lat_trace_set_sink(void (*sink)(const LatTrace&))
+{
+    sink_fn = sink;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <stdint.h>
+#include "log_hist.h"
+
+// ---------------- Input latency tracer ----------------
+// One trace follows a detent from the encoder edge to (a) the changed
+// pixels leaving the flush callback and (b) the volume packet leaving
+// for the DSP. The ISR stamps each edge with the cycle counter; loop()
+// opens a trace with that stamp and every stage below marks itself
+// when it runs. The pipeline is single-threaded, so "the open trace" is
+// the context: no id travels with the data.
+//
+//   EDGE   enc_isr(), cycle counter read on entry
+//   LOOP   poll_encoder() picked the detent up
+//   MODEL  the dial moved (store → observer, master_dial.cpp)
+//   INVAL  first invalidated area after that
+//   FLUSH  first stripe handed to SPI (my_flush_cb returned)
+//   FRAME  refresh complete: every dirty stripe handed to SPI
+//   TX     HelixTx wrote the parameter packet to the transport (only
+//          the publishing link's HelixTx marks, see setTraced())
+//
+// Each stage requires the one before it (TX requires MODEL), so a
+// flush still in flight for an older frame is not taken for this
+// detent. A trace is done at FRAME plus TX (TX only if the link was up
+// when it opened); it then lands in the per-stage histograms and as a
+// LAT_EVENT record in the binary log. If HelixTx ends up with nothing
+// to send for it (the value went back to what the DSP has before the
+// packet left), the trace is closed at FRAME without TX and counted as
+// coalesced, so its photon sample still counts. Detents arriving while a trace is
+// open join it: the screen and the coalescing TX serve them together,
+// and the user waits on the oldest one.
+//
+// Times are cycle-counter deltas, exact to the cycle and good for one
+// counter period (26.8 s at 160 MHz); LAT_TRACE_TIMEOUT_MS closes a
+// trace long before that.
+
+#ifndef LAT_TRACE_TIMEOUT_MS
+#define LAT_TRACE_TIMEOUT_MS 1000   // open longer than this: count and close
+#endif
+
+enum LatStage : uint8_t {
+    LAT_EDGE,
+    LAT_LOOP,
+    LAT_MODEL,
+    LAT_INVAL,
+    LAT_FLUSH,
+    LAT_FRAME,
+    LAT_TX,
+    LAT_STAGES
+};
+
+// ---------------- Tracer ----------------
+struct LatTrace {
+    uint16_t id;
+    uint16_t joined;                    // later detents served by this trace
+    bool     want_tx;
+    uint8_t  stamped;                   // bit per LatStage
+    uint32_t cycles[LAT_STAGES];
+
+    bool has(LatStage s) const { return stamped & (1u << s); }
+    // us from the edge to stage s; -1 if it never happened
+    int32_t us(LatStage s) const;
+};
+
+struct LatTraceStats {
+    uint32_t opened;
+    uint32_t done;
+    uint32_t joined;        // detents that rode on an open trace
+    uint32_t dropped;       // no visible change (end stop)
+    uint32_t coalesced;     // closed without TX: HelixTx had nothing left to send
+    uint32_t timeouts;      // closed by the timeout (kept if FRAME was stamped)
+};
+
+void lat_trace_begin(uint32_t cpu_mhz);
+
+// A detent reached loop(). `edge_cycles` is the ISR's stamp; `want_tx`
+// says whether a packet is expected (link ready). Joins an open trace.
+void lat_trace_open(uint32_t edge_cycles, bool want_tx);
+
+// The detent changed nothing on screen: forget the trace it opened
+void lat_trace_drop();
+
+// Stamp `s` on the open trace, once. Cheap when nothing is open.
+void lat_trace_mark(LatStage s);
+
+// The traced HelixTx dropped its pending write: no TX will come for
+// the open trace, so it finishes at FRAME
+void lat_trace_tx_coalesced();
+
+// Per-stage histograms (edge → stage) since the last reset
+const LogHist& lat_trace_hist(LatStage s);
+void lat_trace_reset_hist();
+
+const LatTraceStats& lat_trace_stats();
+
+// Called with every finished trace (host tools; may be null)
+void lat_trace_set_sink(void (*sink)(const LatTrace&));
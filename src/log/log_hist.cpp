@@ -0,0 +1,44 @@
+#include "log_hist.h"
+
+static_assert(LOG_HIST_BINS % (1 << LOG_HIST_SUB_BITS) == 0, "whole octaves");
+
+uint32_t LogHist::bin_of(uint32_t v)
+{
+    const uint32_t sub = 1u << LOG_HIST_SUB_BITS;
+    if (v < sub) return v;
+
+    uint32_t e = 31 - __builtin_clz(v);        // ≥ LOG_HIST_SUB_BITS
+    uint32_t b = (e - LOG_HIST_SUB_BITS + 1) * sub + ((v >> (e - LOG_HIST_SUB_BITS)) & (sub - 1));
+    return b < LOG_HIST_BINS ? b : LOG_HIST_BINS - 1;
+}
+
+uint32_t LogHist::bin_top(uint32_t bin)
+{
+    const uint32_t sub = 1u << LOG_HIST_SUB_BITS;
+    if (bin < sub) return bin;
+    if (bin >= LOG_HIST_BINS - 1) return UINT32_MAX;
+
+    // Lowest value of the next bin, minus one
+    uint32_t next = bin + 1;
+    uint32_t e = next / sub + LOG_HIST_SUB_BITS - 1;
+    return ((sub + next % sub) << (e - LOG_HIST_SUB_BITS)) - 1;
+}
+
+uint32_t LogHist::percentile(uint32_t pct) const
+{
+    if (!n_) return 0;
+
+    // Rank of the sample, 1-based, rounded up
+    uint64_t rank = ((uint64_t)n_ * pct + 99) / 100;
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (uint32_t b = 0; b < LOG_HIST_BINS; b++) {
+        seen += bins_[b];
+        if (seen >= rank) {
+            uint32_t top = bin_top(b);
+            return top < max_ ? top : max_;
+        }
+    }
+    return max_;
+}
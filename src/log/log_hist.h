@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+
+// ---------------- Log-linear histogram ----------------
+// Fixed size, no allocation, O(1) add: cheap enough to feed from every
+// loop pass. Buckets are exact below 4, then 4 per octave (≤ 25 % wide)
+// up to ~7·10^6; the last bucket takes everything above. Values are
+// usually microseconds (the latency tracer, loop and frame timing) but
+// any count works (pixels per frame).
+// Percentiles report the upper edge of their bucket, capped at the max.
+
+#define LOG_HIST_SUB_BITS 2
+#define LOG_HIST_BINS     88
+
+class LogHist {
+public:
+    void add(uint32_t v)
+    {
+        bins_[bin_of(v)]++;
+        n_++;
+        if (v > max_) max_ = v;
+    }
+
+    // pct in 0..100
+    uint32_t percentile(uint32_t pct) const;
+
+    uint32_t count() const { return n_; }
+    uint32_t max() const { return max_; }
+    uint32_t bin(uint32_t b) const { return bins_[b]; }
+    void clear() { *this = LogHist(); }
+
+    static uint32_t bin_of(uint32_t v);
+    static uint32_t bin_top(uint32_t bin);     // largest value in the bin
+
+private:
+    uint32_t bins_[LOG_HIST_BINS] = {};
+    uint32_t n_ = 0;
+    uint32_t max_ = 0;
+};
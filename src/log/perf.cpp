@@ -0,0 +1,130 @@
+#include "perf.h"
+
+static LogHist hist[PERF_COUNT];
+static uint32_t passes = 0;
+static uint64_t busy_us = 0;
+static uint64_t idle_us = 0;
+static uint32_t window_start_ms = 0;
+
+void perf_add(PerfHist h, uint32_t v)
+{
+    hist[h].add(v);
+}
+
+void perf_busy(uint32_t us)
+{
+    hist[PERF_LOOP].add(us);
+    passes++;
+    busy_us += us;
+}
+
+void perf_idle(uint32_t us)
+{
+    idle_us += us;
+}
+
+const LogHist& perf_hist(PerfHist h)
+{
+    return hist[h];
+}
+
+// ---------------- Dump ----------------
+// Encoded into a static buffer on request and drained in whatever the
+// port takes per pass, so a dump never blocks the loop. Sized for the
+// worst case: every bin used and every varint at full length.
+static const uint32_t FRAME_MAX =
+    4 + 4 + 2 * 5 + 2 * 10 + PERF_COUNT * (1 + 5 + 5 + 1 + LOG_HIST_BINS * (1 + 5)) + 1;
+
+static uint8_t frame[FRAME_MAX];
+static uint32_t frame_len = 0;
+static uint32_t frame_sent = 0;
+
+struct PerfSink {
+    uint8_t* p;
+    uint32_t len;
+    uint8_t sum;
+
+    void byte(uint8_t b)
+    {
+        sum += b;
+        p[len++] = b;
+    }
+
+    void varint(uint64_t v)
+    {
+        while (v >= 0x80) {
+            byte((uint8_t)v | 0x80);
+            v >>= 7;
+        }
+        byte((uint8_t)v);
+    }
+};
+
+static void encode(PerfSink& s, uint32_t window_ms)
+{
+    s.byte(PERF_VERSION);
+    s.byte(LOG_HIST_SUB_BITS);
+    s.byte(LOG_HIST_BINS);
+    s.byte(PERF_COUNT);
+    s.varint(window_ms);
+    s.varint(passes);
+    s.varint(busy_us);
+    s.varint(idle_us);
+
+    for (uint8_t h = 0; h < PERF_COUNT; h++) {
+        const LogHist& hh = hist[h];
+        uint8_t used = 0;
+        for (uint32_t b = 0; b < LOG_HIST_BINS; b++)
+            if (hh.bin(b)) used++;
+
+        s.byte(h);
+        s.varint(hh.count());
+        s.varint(hh.max());
+        s.byte(used);
+        for (uint32_t b = 0; b < LOG_HIST_BINS; b++) {
+            if (!hh.bin(b)) continue;
+            s.byte((uint8_t)b);
+            s.varint(hh.bin(b));
+        }
+    }
+}
+
+void perf_dump()
+{
+    if (!perf_empty()) return;
+
+    uint32_t now = millis();
+    PerfSink body = { frame + 4, 0, 0 };
+    encode(body, now - window_start_ms);
+
+    frame[0] = PERF_SYNC;
+    frame[1] = PERF_TAG;
+    frame[2] = (uint8_t)body.len;
+    frame[3] = (uint8_t)(body.len >> 8);
+    frame[4 + body.len] = body.sum;
+    frame_len = 4 + body.len + 1;
+    frame_sent = 0;
+
+    for (LogHist& h : hist) h.clear();
+    passes = 0;
+    busy_us = idle_us = 0;
+    window_start_ms = now;
+}
+
+void perf_drain(Print& out)
+{
+    while (frame_sent < frame_len) {
+        int room = out.availableForWrite();
+        if (room <= 0) return;
+
+        uint32_t n = frame_len - frame_sent;
+        if (n > (uint32_t)room) n = room;
+        out.write(frame + frame_sent, n);
+        frame_sent += n;
+    }
+}
+
+bool perf_empty()
+{
+    return frame_sent == frame_len;
+}
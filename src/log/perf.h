@@ -0,0 +1,71 @@
+#pragma once
+#include <Arduino.h>
+#include "log_hist.h"
+
+// ---------------- Performance counters ----------------
+// Always-on timing of the frame pipeline and of loop(), kept in
+// fixed-size histograms (log_hist.h). Feeding one is a bucket lookup
+// and two increments; nothing is formatted on the device.
+//
+//   FRAME   REFR_START → REFR_READY, refreshes that flushed something
+//   RENDER  CPU busy rendering within the frame
+//   FLUSH   CPU blocked in the flush / flush-wait callbacks
+//   AREA    pixels sent over SPI per frame
+//   LOOP    one loop() pass, up to the point where it waits
+//   HELIX   helix_loop()
+//
+// Time spent waiting (ui_sched_wait, light sleep, delay) is summed
+// next to the busy time, which gives the idle fraction.
+//
+// Sending PERF_DUMP_CMD on the console makes the next pass encode one
+// binary frame (decoded by tools/perf_view.py) and start a new window:
+//
+//   0xB2  'P'  len16  payload  sum8(payload)
+//   payload: version  sub_bits  bins  n_hists
+//            varint(window_ms) varint(passes) varint(busy_us) varint(idle_us)
+//            per histogram: id varint(n) varint(max) n_bins {bin varint(count)}
+//
+// len16 is little-endian and counts the payload. The frame goes out
+// through perf_drain() from the loop's idle path, as the port has room,
+// like binlog_drain(); binlog records wait until it is complete.
+
+#define PERF_HISTS(X) \
+    X(FRAME,  "frame",  "us") \
+    X(RENDER, "render", "us") \
+    X(FLUSH,  "flush",  "us") \
+    X(AREA,   "area",   "px") \
+    X(LOOP,   "loop",   "us") \
+    X(HELIX,  "helix",  "us")
+
+enum PerfHist : uint8_t {
+#define X(name, label, unit) PERF_##name,
+    PERF_HISTS(X)
+#undef X
+    PERF_COUNT
+};
+
+#define PERF_SYNC       0xB2
+#define PERF_TAG        'P'
+#define PERF_VERSION    1
+
+#ifndef PERF_DUMP_CMD
+#define PERF_DUMP_CMD   'p'
+#endif
+
+void perf_add(PerfHist h, uint32_t v);
+
+// loop(): the pass worked for `us`, then waited for `us`
+void perf_busy(uint32_t us);
+void perf_idle(uint32_t us);
+
+const LogHist& perf_hist(PerfHist h);
+
+// Encode the window as one frame, then start a new one. Ignored while
+// the previous frame is still going out.
+void perf_dump();
+
+// Write as much of the frame as `out` takes without blocking
+void perf_drain(Print& out);
+
+// Nothing left to send
+bool perf_empty();
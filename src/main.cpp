@@ -1,19 +1,17 @@
 #include <Arduino.h>
 #include "pages/master_dial.h"
 #include "protocol/helix_protocol.h"
-
-// TFT / LVGL order matters!
-#include <TFT_eSPI.h>
+#include "display/display.h"
+#include "input/encoder.h"
+#include "sched/ui_sched.h"
+#include "sched/governor.h"
+#include "log/binlog.h"
+#include "log/lat_trace.h"
+#include "log/perf.h"
+#include "model/params.h"
 #include <lvgl.h>
-
-#define LV_LVGL_TFT_ESPI_IMPLEMENTATION
-
-// Global display object
-TFT_eSPI tft = TFT_eSPI();
-
-// function prototypes so setup() can call them
-void init_display();
-void my_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p);
+#include <soc/gpio_reg.h>
+#include <hal/cpu_hal.h>
 
 // ---------------- Pin Mapping ----------------
 #define PIN_BL      8   // Backlight LOW = ON
@@ -23,55 +21,114 @@ void my_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p);
 #define DSP_RX_PIN 20   // ESP receives from DSP (red wire → RX1)
 #define DSP_TX_PIN 21   // ESP transmits to DSP (white wire → TX1)
 
+#ifndef DSP_UART_DRIVER_RX
+#define DSP_UART_DRIVER_RX 1024 // IDF driver buffer, in front of the protocol's ring
+#endif
+#ifndef DSP_UART_FIFO_FULL
+#define DSP_UART_FIFO_FULL 32   // FIFO level that raises the RX interrupt (of 128)
+#endif
+
 
 // ---------------- Encoder Globals ----------------
-static volatile int enc_delta = 0;
-static volatile uint8_t prev_state = 0;
+static EncoderFilter enc_filter;        // glitch filter + ISR load counters
+static EncoderRing enc_events;          // ISR → loop, timestamped transitions
+static EncoderDecoder enc_decoder;      // detents + acceleration (input/encoder.cpp)
 static volatile bool enc_pressed = false;
 
-// ---------------- Gray Code Table ----------------
-static const int8_t transition_table[4][4] = {
-    {  0, -1, +1,  0 },
-    { +1,  0,  0, -1 },
-    { -1,  0,  0, +1 },
-    {  0, +1, -1,  0 }
-};
+#ifndef ENC_REPORT_MS
+#define ENC_REPORT_MS 10000     // 0 = no periodic ISR report
+#endif
 
-void my_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p)
-{
-    uint32_t w = area->x2 - area->x1 + 1;
-    uint32_t h = area->y2 - area->y1 + 1;
+// ---------------- Encoder ISR ----------------
+void IRAM_ATTR enc_isr() {
+    uint32_t c0 = cpu_hal_get_cycle_count();
 
-    tft.startWrite();
-    tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.pushColors((uint16_t *)color_p, w * h, true);
-    tft.endWrite();
+    // Both pins from one input-register read, so A and B are coherent
+    uint32_t in = REG_READ(GPIO_IN_REG);
+    uint8_t state = (((in >> PIN_ENC_A) & 1) << 1) | ((in >> PIN_ENC_B) & 1);
 
-    lv_display_flush_ready(disp);
+    if (enc_filter.edge(state, c0)) {
+        enc_events.push(micros(), state, c0);
+        ui_sched_wake_from_isr();
+    }
+
+    enc_filter.isr_cycles(cpu_hal_get_cycle_count() - c0);
 }
 
-void init_display()
+void IRAM_ATTR enc_btn_isr() {
+    enc_pressed = !digitalRead(PIN_ENC_BTN);   // active low
+    ui_sched_wake_from_isr();
+}
+
+// ---------------- Input Latency ----------------
+// Every detent is traced from its encoder edge through the store, the
+// invalidation and the flush to the photon, and to the volume packet on
+// the UART (log/lat_trace.h). The report prints p50/p99/max per stage,
+// measured from the edge, over the last window.
+#ifndef LAT_REPORT_MS
+#define LAT_REPORT_MS 10000     // 0 = no periodic latency report
+#endif
+
+static bool redraw_now = false;     // a detent moved the dial: refresh this pass
+
+static void lat_print_stage(const char* name, LatStage s)
 {
-    tft.init();
-    tft.setRotation(1);
-    tft.fillScreen(TFT_BLACK);
+    const LogHist& h = lat_trace_hist(s);
+    Serial.printf("  %s=%u/%u/%u", name, h.percentile(50), h.percentile(99), h.max());
+}
 
-    pinMode(8, OUTPUT);
-    digitalWrite(8, LOW);
+static void lat_report(uint32_t now)
+{
+    static uint32_t last = 0;
+    if (!LAT_REPORT_MS || now - last < LAT_REPORT_MS) return;
+    last = now;
+    if (!lat_trace_hist(LAT_FRAME).count()) return;
+
+    Serial.printf("[LAT] %s  edge→ p50/p99/max us:", UI_EVENT_LOOP ? "event" : "poll5");
+    lat_print_stage("loop", LAT_LOOP);
+    lat_print_stage("model", LAT_MODEL);
+    lat_print_stage("flush", LAT_FLUSH);
+    lat_print_stage("photon", LAT_FRAME);
+    lat_print_stage("uart", LAT_TX);
+
+    const LatTraceStats& lt = lat_trace_stats();
+    const UiSchedStats& ss = ui_sched_stats();
+    Serial.printf("  (%u/%u)  joined=%u coalesced=%u timeouts=%u  passes=%u woken=%u timeout=%u\n",
+                  lat_trace_hist(LAT_FRAME).count(), lat_trace_hist(LAT_TX).count(),
+                  lt.joined, lt.coalesced, lt.timeouts, ss.passes, ss.woken, ss.timed_out);
+    lat_trace_reset_hist();
 }
 
-// ---------------- Encoder ISR ----------------
-void IRAM_ATTR enc_isr() {
-    uint8_t a = digitalRead(PIN_ENC_A);
-    uint8_t b = digitalRead(PIN_ENC_B);
-    uint8_t state = (a << 1) | b;
+// ---------------- DSP UART RX ----------------
+// The IDF driver's ISR empties the 128-byte hardware FIFO (about 5.5 ms
+// at 230400 baud) into its buffer, and its event task then runs
+// on_dsp_rx(), which moves the bytes into the protocol's ring. Neither
+// waits for loop(), so a long frame render no longer costs blob bytes.
+static void on_dsp_rx()
+{
+    helix_rx_pump();
+    ui_sched_wake();    // UART event task → wake the UI task
+}
 
-    enc_delta += transition_table[prev_state][state];
-    prev_state = state;
+static void on_dsp_rx_error(hardwareSerial_error_t err)
+{
+    switch (err) {
+    case UART_FIFO_OVF_ERROR:    helix_rx_error(HELIX_RX_FIFO_OVERFLOW); break;
+    case UART_BUFFER_FULL_ERROR: helix_rx_error(HELIX_RX_DRIVER_FULL);   break;
+    default:                     helix_rx_error(HELIX_RX_LINE_ERROR);    break;
+    }
 }
 
-void IRAM_ATTR enc_btn_isr() {
-    enc_pressed = !digitalRead(PIN_ENC_BTN);   // active low
+// After light sleep: the wake edge never reached the ISRs
+static void enc_resample()
+{
+    enc_isr();
+    enc_btn_isr();
+}
+
+static uint32_t lv_tick_ms()
+{
+    return millis();
 }
 
 // ---------------- Setup ----------------
@@ -87,73 +144,222 @@ void setup() {
     pinMode(PIN_ENC_B, INPUT_PULLUP);
     pinMode(PIN_ENC_BTN, INPUT_PULLUP);
 
+    uint8_t enc_state = (digitalRead(PIN_ENC_A) << 1) | digitalRead(PIN_ENC_B);
+    enc_filter.begin(enc_state, getCpuFrequencyMhz());
+    enc_decoder.begin(enc_state);
+    lat_trace_begin(getCpuFrequencyMhz());
+
     attachInterrupt(PIN_ENC_A,  enc_isr, CHANGE);
     attachInterrupt(PIN_ENC_B,  enc_isr, CHANGE);
     attachInterrupt(PIN_ENC_BTN, enc_btn_isr, CHANGE);
 
     // -------- LVGL Core Init --------
     lv_init();
+    lv_tick_set_cb(lv_tick_ms);
+    params_init();      // shared store: protocol writes, pages observe
 
-    // -------- TFT Driver Init (SPI + GC9A01A) --------
-    init_display();
-
-    // -------- LVGL Display Object --------
-    lv_display_t* disp = lv_display_create(240, 240);
-
-    static uint16_t buf1[240 * 40];
-    static uint16_t buf2[240 * 40];
-
-    lv_display_set_buffers(
-        disp,
-        buf1, buf2,
-        sizeof(buf1),
-        LV_DISPLAY_RENDER_MODE_PARTIAL
-    );
-
-    lv_display_set_flush_cb(disp, my_flush_cb);
+    // -------- TFT + LVGL Display (see display/display.cpp) --------
+    lv_display_t* disp = display_begin();
 
     master_dial_create(lv_scr_act());
 
     Serial.println("Setup complete.");
+    Serial1.setRxBufferSize(DSP_UART_DRIVER_RX);    // only takes effect before begin()
     Serial1.begin(
     230400,
     SERIAL_8N1,
     DSP_RX_PIN,
     DSP_TX_PIN
     );
+    Serial1.setRxFIFOFull(DSP_UART_FIFO_FULL);      // drain early: ISR latency margin
     helix_begin(Serial1);
+    Serial1.onReceiveError(on_dsp_rx_error);
+    Serial1.onReceive(on_dsp_rx);
+
+    ui_sched_begin();
+
+    // -------- Power governor (see sched/governor.h) --------
+    GovWakeSources wake = {};
+    wake.pins[wake.n_pins++] = PIN_ENC_A;
+    wake.pins[wake.n_pins++] = PIN_ENC_B;
+    wake.pins[wake.n_pins++] = PIN_ENC_BTN;
+    wake.uart = 1;                      // Serial1, RX on DSP_RX_PIN
+    wake.resample = enc_resample;
+    gov_begin(disp, wake);
 
 }
 
 // -------------------- Loop --------------------
-void loop()
+static void enc_report(uint32_t now)
 {
-    helix_loop();
+    static uint32_t last_enc_report = 0;
+    static uint32_t last_enc_edges = 0;
+    if (!ENC_REPORT_MS || now - last_enc_report < ENC_REPORT_MS) return;
+
+    const EncIsrStats& st = enc_filter.stats();
+    if (st.edges != last_enc_edges) {
+        uint32_t mhz = getCpuFrequencyMhz();
+        Serial.printf(
+            "[ENC] edges=%u ok=%u rej: nochange=%u invalid=%u bounce=%u  isr avg=%uns max=%uns  ring drops=%u\n",
+            st.edges, st.accepted, st.rej_nochange, st.rej_invalid, st.rej_bounce,
+            (uint32_t)(st.cycles_total * 1000 / st.edges / mhz), st.cycles_max * 1000 / mhz,
+            enc_events.dropped());
+        last_enc_edges = st.edges;
+    }
+    last_enc_report = now;
+}
+
+#ifndef GOV_REPORT_MS
+#define GOV_REPORT_MS 30000     // 0 = no periodic governor report
+#endif
 
-    // -------- LVGL Tick --------
+static void gov_report(uint32_t now)
+{
     static uint32_t last = 0;
-    uint32_t now = millis();
-    lv_tick_inc(now - last);
+    if (!GOV_REPORT_MS || now - last < GOV_REPORT_MS) return;
     last = now;
 
-    lv_timer_handler();   // let LVGL render
+    const GovStats& g = gov_stats();
+    Serial.printf(
+        "[GOV] active=%ums settled=%ums idle=%ums  sleeps=%u (%ums) wake gpio/uart/timer=%u/%u/%u  wake→frame avg=%uus max=%uus (%u, after resume; excl. hw wake)\n",
+        g.mode_ms[GOV_ACTIVE], g.mode_ms[GOV_SETTLED], g.mode_ms[GOV_IDLE],
+        g.sleeps, g.slept_ms, g.wake_gpio, g.wake_uart, g.wake_timer,
+        g.w2f_n ? g.w2f_sum_us / g.w2f_n : 0, g.w2f_max_us, g.w2f_n);
+}
+
+#ifndef RX_REPORT_MS
+#define RX_REPORT_MS 10000      // 0 = no periodic UART RX report
+#endif
 
-    // -------- Encoder Detents --------
-    noInterrupts();
-    int delta = enc_delta;
-    enc_delta = 0;
-    interrupts();
+static void rx_report(uint32_t now)
+{
+    static uint32_t last = 0;
+    static uint32_t last_pumped = 0;
+    if (!RX_REPORT_MS || now - last < RX_REPORT_MS) return;
+    last = now;
+
+    const HelixRxPathStats& r = helix_rx_path_stats();
+    if (r.pumped == last_pumped) return;
+    last_pumped = r.pumped;
+    Serial.printf(
+        "[RX] bytes=%u  ring high-water=%u/%u full=%u  lost: fifo ovf=%u driver full=%u  line errors=%u\n",
+        r.pumped, r.high_water, r.ring_size, r.ring_full,
+        r.fifo_overflow, r.driver_full, r.line_errors);
+}
+
+// ---------------- Console commands ----------------
+// Single bytes from the host; anything else is ignored. While the
+// governor has the chip in light sleep a request waits for the next wake.
+static void console_poll()
+{
+    while (Serial.available() > 0) {
+        if (Serial.read() == PERF_DUMP_CMD) perf_dump();
+    }
+}
+
+static void poll_encoder()
+{
+    int delta = enc_decoder.poll(enc_events);
 
     if (delta != 0) {
+        gov_activity(millis());
+        lat_trace_open(enc_decoder.last_detent_cycles(), helix_ready());
+        int shown = master_dial_get_value();
         master_dial_set_value(delta);
+        if (master_dial_get_value() != shown) redraw_now = true;
+        else lat_trace_drop();      // clamped at an end stop: nothing to see
     }
 
-    // -------- Encoder Button --------
     static bool last_btn = false;
     if (enc_pressed != last_btn) {
-        Serial.printf("Button: %s\n", enc_pressed ? "PRESSED" : "RELEASED");
+        gov_activity(millis());
+        if (enc_pressed) BLOG(BUTTON_DOWN);
+        else             BLOG(BUTTON_UP);
         last_btn = enc_pressed;
     }
+}
+
+static void timed_helix_loop()
+{
+    uint32_t t0 = micros();
+    helix_loop();
+    perf_add(PERF_HELIX, micros() - t0);
+}
+
+#if UI_EVENT_LOOP
+void loop()
+{
+    uint32_t t_pass = micros();
+
+    // Input first so the TX and the redraw below go out in this same pass
+    poll_encoder();
+
+    timed_helix_loop();
+
+    // Draw now rather than on the next LV_DEF_REFR_PERIOD boundary
+    if (redraw_now)
+        lv_timer_ready(lv_display_get_refr_timer(lv_display_get_default()));
+
+    uint32_t lv_due = lv_timer_handler();   // ms until the next LVGL timer
+    redraw_now = false;
+
+    uint32_t now = millis();
+    display_report();
+    enc_report(now);
+    lat_report(now);
+    gov_report(now);
+    rx_report(now);
+    GovMode mode = gov_update(now);
+
+    // Idle from here on: only now does the console get its bytes
+    console_poll();
+    perf_drain(Serial);
+    if (perf_empty()) binlog_drain(Serial);    // never inside a perf frame
+
+    uint32_t tx_due = helix_next_due_ms();
+    uint32_t wait = lv_due < tx_due ? lv_due : tx_due;
+    bool draining = !binlog_empty() || !perf_empty();
+    if (draining && wait > 1) wait = 1;         // port was full; retry soon
+
+    uint32_t t_idle = micros();
+    perf_busy(t_idle - t_pass);
+
+    if (GOV_LIGHT_SLEEP && mode == GOV_IDLE && !draining) {
+        if (ui_sched_take_pending()) return;    // an event slipped in: another pass
+        Serial1.flush();                        // DSP TX FIFO empty before the clocks stop
+        gov_light_sleep(wait);
+    } else {
+        ui_sched_wait(wait);
+    }
+    perf_idle(micros() - t_idle);
+}
+#else
+void loop()
+{
+    uint32_t t_pass = micros();
 
+    timed_helix_loop();
+
+    lv_timer_handler();   // let LVGL render
+    redraw_now = false;
+
+    poll_encoder();
+
+    uint32_t now = millis();
+    display_report();
+    enc_report(now);
+    lat_report(now);
+    gov_report(now);
+    rx_report(now);
+    gov_update(now);    // refresh period only; no sleep in the polled loop
+
+    console_poll();
+    perf_drain(Serial);
+    if (perf_empty()) binlog_drain(Serial);    // never inside a perf frame
+
+    uint32_t t_idle = micros();
+    perf_busy(t_idle - t_pass);
     delay(5);   // keep CPU cool, LVGL tolerates this fine
+    perf_idle(micros() - t_idle);
 }
+#endif
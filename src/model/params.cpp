@@ -0,0 +1,25 @@
+#include "params.h"
+
+lv_subject_t param_master_index;
+lv_subject_t param_master_max;
+lv_subject_t param_master_steps;
+lv_subject_t param_step_db10;
+
+void params_init()
+{
+    static bool done = false;
+    if (done) return;
+    done = true;
+
+    lv_subject_init_int(&param_master_index, PARAM_DEFAULT_STEPS);    // 0 dB
+    lv_subject_init_int(&param_master_max, 2 * PARAM_DEFAULT_STEPS);
+    lv_subject_init_int(&param_master_steps, PARAM_DEFAULT_STEPS);
+    lv_subject_init_int(&param_step_db10, PARAM_DEFAULT_STEP_DB10);
+}
+
+bool params_set(lv_subject_t* s, int32_t value)
+{
+    if (lv_subject_get_int(s) == value) return false;
+    lv_subject_set_int(s, value);
+    return true;
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <lvgl.h>
+
+// ---------------- Shared parameter store ----------------
+// LVGL observer subjects for the values both the UI and the DSP link
+// care about. The publishing HelixLink is the only writer: it applies encoder
+// intent (helix_volume_delta) and values reported by the DSP, then
+// publishes the result here. Pages only observe, so what the screen
+// shows is always what the protocol believes the DSP has.
+//
+// Writes go through params_set(), which skips unchanged values so
+// observers only run on a real change.
+
+// Until the configuration blob says otherwise: 60 steps of 0.5 dB
+#define PARAM_DEFAULT_STEPS     60
+#define PARAM_DEFAULT_STEP_DB10 5
+
+extern lv_subject_t param_master_index;     // authoritative step index, 0..max
+extern lv_subject_t param_master_max;       // 2 * steps (index of +max dB)
+extern lv_subject_t param_master_steps;     // index of 0 dB
+extern lv_subject_t param_step_db10;        // dB per step, tenths
+
+// Safe to call more than once; whoever starts first (UI or link) inits
+void params_init();
+
+// Set and notify only if the value differs; true if it changed
+bool params_set(lv_subject_t* s, int32_t value);
+
+static inline int32_t params_get(lv_subject_t* s)
+{
+    return lv_subject_get_int(s);
+}
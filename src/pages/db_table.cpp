@@ -0,0 +1,45 @@
+#include "db_table.h"
+
+static char strings[DB_TABLE_MAX_INDEX + 1][DB_TABLE_STR_LEN];
+static int built_max = -1;
+
+static void format_db10(char* out, int32_t db10)
+{
+    char* p = out;
+    if (db10 < 0)      *p++ = '-';
+    else if (db10 > 0) *p++ = '+';
+
+    uint32_t a = db10 < 0 ? -db10 : db10;
+    if (a > 99999) a = 99999;   // nonsense scale from the blob: pin, don't overflow
+    uint32_t whole = a / 10;
+
+    char rev[4];                // "-9999.9" + NUL fits DB_TABLE_STR_LEN
+    int n = 0;
+    do {
+        rev[n++] = '0' + whole % 10;
+        whole /= 10;
+    } while (whole);
+    while (n) *p++ = rev[--n];
+
+    *p++ = '.';
+    *p++ = '0' + a % 10;
+    *p = '\0';
+}
+
+void db_table_build(int zero_index, int step_db10, int max_index)
+{
+    if (max_index > DB_TABLE_MAX_INDEX) max_index = DB_TABLE_MAX_INDEX;
+    if (max_index < 0) max_index = 0;
+
+    for (int i = 0; i <= max_index; i++)
+        format_db10(strings[i], (int32_t)(i - zero_index) * step_db10);
+    built_max = max_index;
+}
+
+const char* db_table_get(int index)
+{
+    if (built_max < 0) return "";
+    if (index < 0) index = 0;
+    if (index > built_max) index = built_max;
+    return strings[index];
+}
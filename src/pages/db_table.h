@@ -0,0 +1,17 @@
+#pragma once
+#include <stdint.h>
+
+// ---------------- Master dB strings ----------------
+// One ready-to-show string per master index, e.g. "-12.5", "0.0", "+3.0",
+// built with integer math only (no FPU on the C3, LV_USE_FLOAT 0).
+// Rebuilt when the blob changes the scale; lookups are a pointer into
+// the table, so the dial can hand it to lv_label_set_text_static().
+
+#define DB_TABLE_MAX_INDEX 254      // index travels as one byte
+#define DB_TABLE_STR_LEN   8        // "-127.5" + NUL, rounded up
+
+// dB(idx) = (idx - zero_index) * step_db10 / 10
+void db_table_build(int zero_index, int step_db10, int max_index);
+
+// Clamped to the built range; never null
+const char* db_table_get(int index);
@@ -0,0 +1,7304 @@
+// Generated by tools/gen_dial_ring.py -- do not edit.
+#include "dial_ring_sprite.h"
+
+#define P(v) DIAL_RING_RGB(v)
+
+const uint16_t dial_ring_bg[38060] = {
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x2124), P(0x3186), P(0x5ACB), P(0x632C), P(0x632C), P(0x9CD3), P(0x9CD3), P(0x9CD3), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x9CD3), P(0x9CD3), P(0x9CD3), P(0x632C),
+    P(0x632C), P(0x5ACB), P(0x3186), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x3186), P(0x5ACB),
+    P(0x738E), P(0x9CD3), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x9CD3), P(0x738E),
+    P(0x5ACB), P(0x3186), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0x632C), P(0x8C71),
+    P(0xB596), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596), P(0x8C71), P(0x632C), P(0x3186), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0x632C), P(0x9CD3),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x632C), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0x4A69), P(0x8C71),
+    P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7),
+    P(0x8C71), P(0x4A69), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0x5ACB),
+    P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x5ACB), P(0x18C3), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861),
+    P(0x4A69), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xA534), P(0x4A69), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x3186), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x3186), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0861), P(0x5ACB), P(0xB596), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596), P(0x5ACB), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0x8410), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x8410), P(0x18C3),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0x9CD3), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x3186),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0x9CD3),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x18C3), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x18C3),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0861), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x4A69), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x2124), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xA534), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xA534), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xBDF7), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x4A69), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x8410),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x8410), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x18C3), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xBDF7), P(0x9CD3), P(0x8C71), P(0x632C), P(0x632C), P(0x3186), P(0x3186), P(0x3186), P(0x0861), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x3186), P(0x3186), P(0x3186), P(0x632C), P(0x632C),
+    P(0x8C71), P(0x9CD3), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x3186),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xA534), P(0x738E), P(0x5ACB), P(0x3186), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x3186), P(0x5ACB), P(0x738E), P(0xA534),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4A69), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x9CD3), P(0x632C), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0x632C), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0861), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xB596), P(0x738E), P(0x4208), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x4208), P(0x738E), P(0xB596), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x8C71), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xB596), P(0x738E), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0x738E), P(0xB596), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0861), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xBDF7), P(0x8410), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0x8410), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xA534), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xBDF7), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x4A69), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x4A69), P(0xA534),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x2124), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x2124),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x18C3), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0x8410),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x18C3),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x2124), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x8C71), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0x8C71),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xBDF7), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0861), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xA534), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x5ACB), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x5ACB), P(0xBDF7),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534),
+    P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x0861), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x4208), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4208), P(0xBDF7), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x8C71), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0861), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x4A69), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xBDF7), P(0x4A69), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xBDF7), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x2124), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7),
+    P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xA534),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0861), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xBDF7), P(0x4208), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4208), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x4A69), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xBDF7), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xBDF7),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x2124), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0861),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xA534), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xA534), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0861), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x2124), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xA534), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xA534), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0861), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861),
+    P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0861),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x2124),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xBDF7), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xBDF7), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2124), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4A69), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4208), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4208), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xBDF7), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xA534), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x2124), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2124), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x4A69), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4208), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4208), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8C71), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x5ACB),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xB596), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0861), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4A69), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xA534), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xA534), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xA534), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xA534), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x4A69), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4A69),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xB596),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x738E), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x738E), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0xB596), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x738E), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x738E), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4208),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4208), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xB596), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0861), P(0x0000),
+    P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x0000), P(0x0000), P(0x738E), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xA534), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x738E), P(0x0000),
+    P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x738E), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x738E), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000),
+    P(0x2124), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0861), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x2124), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB),
+    P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3),
+    P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3),
+    P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C),
+    P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xBDF7),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186),
+    P(0x2124), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0861), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x2124), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0xBDF7), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x5ACB), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0000),
+    P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x738E), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x738E), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x738E), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x738E), P(0x0000), P(0x0000), P(0x5ACB), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x0000),
+    P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0861), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0xB596), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4208), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4208), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x738E),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x738E), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0xB596), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x2124), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x738E), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x738E), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xB596),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x2124), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2124), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4A69),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4A69), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xA534), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4A69), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0xB596), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xB596),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x5ACB), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x5ACB), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8410), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0861), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xBDF7),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x8C71), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x8C71), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4208), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4208), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x0861),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0x9CD3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xBDF7), P(0x4208), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x4208), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x3186),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x8410), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x2124),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x8410), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0x738E), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x738E), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x3186), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0861), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x8C71), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x8C71), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xBDF7), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4A69), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x4A69), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x4A69), P(0xBDF7), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x4A69), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3),
+    P(0x18C3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x18C3), P(0x9CD3), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x9CD3), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x632C), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x2124),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x2124), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79),
+    P(0xCE79), P(0xCE79), P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0xA534), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0x738E), P(0x0861), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861),
+    P(0x738E), P(0xCE79), P(0xCE79), P(0xCE79), P(0xCE79), P(0xA534), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2124), P(0xCE79), P(0xCE79), P(0xBDF7), P(0x3186), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3186), P(0xBDF7), P(0xCE79), P(0xCE79), P(0x2124), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x632C),
+    P(0x8C71), P(0x0861), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0861), P(0x8C71),
+    P(0x632C), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+};
+
+const uint16_t dial_ring_ind[38060] = {
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0921), P(0x1182), P(0x1AC3), P(0x2324), P(0x2324), P(0x34C6), P(0x34C6), P(0x34C6), P(0x3526), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x34C6), P(0x34C6), P(0x34C6), P(0x2324),
+    P(0x2324), P(0x1AC3), P(0x1182), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x1182), P(0x1AC3),
+    P(0x2384), P(0x34C6), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x34C6), P(0x2384),
+    P(0x1AC3), P(0x1182), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x2324), P(0x2C65),
+    P(0x3D87), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3D87), P(0x2C65), P(0x2324), P(0x1182), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x2324), P(0x34C6),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x2324), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x1A63), P(0x2C65),
+    P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8),
+    P(0x2C65), P(0x1A63), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x1AC3),
+    P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x1AC3), P(0x08C1), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060),
+    P(0x1A63), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x3526), P(0x1A63), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x1182), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x1182), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0060), P(0x1AC3), P(0x3D87), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x3D87), P(0x1AC3), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x2C05), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x2C05), P(0x08C1),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x34C6), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x1182),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x34C6),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x08C1), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x08C1),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0060), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x1A63), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x34C6), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0921), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x3526), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x3526), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x45E8), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x1A63), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x2C05),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x2C05), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x08C1), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x45E8), P(0x34C6), P(0x2C65), P(0x2324), P(0x2324), P(0x1182), P(0x1182), P(0x1182), P(0x0060), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x1182), P(0x1182), P(0x1182), P(0x2324), P(0x2324),
+    P(0x2C65), P(0x34C6), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x1182),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x3526), P(0x2384), P(0x1AC3), P(0x1182), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x1182), P(0x1AC3), P(0x2384), P(0x3526),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1A63), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x34C6), P(0x2324), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x2324), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0060), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x3D87), P(0x2384), P(0x1202), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x1202), P(0x2384), P(0x3D87), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x2C65), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x3D87), P(0x2384), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x2384), P(0x3D87), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0060), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x45E8), P(0x2C05), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x2C05), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x3526), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x45E8), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x1A63), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x1A63), P(0x3526),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0921), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0921),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x08C1), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x2C05),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x08C1),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0921), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x2C65), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x2C65),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x45E8), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0060), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x3526), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x1AC3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1AC3), P(0x45E8),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526),
+    P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x0060), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x1202), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1202), P(0x45E8), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x2C65), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0060), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x1A63), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x45E8), P(0x1A63), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x45E8), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x45E8), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0921), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8),
+    P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x3526),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0060), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x45E8), P(0x1202), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1202), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x1A63), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x45E8), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x45E8),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0921), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0060),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x3526), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x3526), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0060), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0921), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3526), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x3526), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0060), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060),
+    P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0060),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0921),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x45E8), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x45E8), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0921), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1A63), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1202), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1202), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x45E8), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x3526), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0921), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0921), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x1A63), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1202), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1202), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C65), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x08C1), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1AC3),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3D87), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x3D87), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0060), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x08C1), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1A63), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3526), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x3526), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x08C1), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3526), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x3526), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x08C1), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x1A63), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1A63),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C65), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3D87), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3D87),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2384), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2384), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x3D87), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x3D87), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2384), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2384), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1202),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1202), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3D87), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3D87), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0060), P(0x0000),
+    P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x0000), P(0x0000), P(0x2384), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3526), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2384), P(0x0000),
+    P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x2384), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2384), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0000), P(0x0000), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000),
+    P(0x0921), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0060), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x0921), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x1AC3), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3),
+    P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x34C6), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6),
+    P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x3526), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x34C6), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6),
+    P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x2324), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324),
+    P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x1182), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x45E8),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182),
+    P(0x0921), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0060), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x0921), P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x45E8), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1AC3), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0000),
+    P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x2384), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2384), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x2384), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2384), P(0x0000), P(0x0000), P(0x1AC3), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x0000),
+    P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0060), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x3D87), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3D87), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1202), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1202), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2384),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2384), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x3D87), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x3D87), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0921), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x2384), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2384), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3D87), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3D87),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x45E8), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0921), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0921), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1A63),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1A63), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x3526), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1A63), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x3D87), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C65), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3D87),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1AC3), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1AC3), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C05), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0060), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x45E8),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2C65), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x2C65), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1202), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1202), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x0060),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x34C6), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x45E8), P(0x1202), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x1202), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1182),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x2C05), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0921),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x2C05), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x2384), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x2384), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x1182), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0060), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2C65), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x2C65), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x45E8), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1A63), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x45E8), P(0x1A63), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x1A63), P(0x45E8), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x1A63), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x34C6), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6),
+    P(0x08C1), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x08C1), P(0x34C6), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x34C6), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x2324), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x0921),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0921), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668),
+    P(0x4668), P(0x4668), P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x3526), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x2384), P(0x0060), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060),
+    P(0x2384), P(0x4668), P(0x4668), P(0x4668), P(0x4668), P(0x3526), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0921), P(0x4668), P(0x4668), P(0x45E8), P(0x1182), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x1182), P(0x45E8), P(0x4668), P(0x4668), P(0x0921), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x2324),
+    P(0x2C65), P(0x0060), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0060), P(0x2C65),
+    P(0x2324), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+    P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000), P(0x0000),
+};
+
+#undef P
+
+const DialRingBox dial_ring_rects[4873] = {
+    { 39, 158, 39, 158 }, { 38, 159, 39, 159 }, { 37, 160, 38, 160 }, { 35, 161, 36, 161 }, { 34, 162, 35, 162 }, { 32, 163, 34, 163 },
+    { 31, 164, 32, 164 }, { 29, 165, 31, 165 }, { 28, 166, 29, 166 }, { 26, 167, 28, 167 }, { 25, 168, 26, 168 }, { 23, 169, 25, 169 },
+    { 22, 170, 24, 170 }, { 21, 171, 22, 171 }, { 19, 172, 21, 172 }, { 38, 158, 39, 158 }, { 37, 159, 39, 159 }, { 35, 160, 38, 160 },
+    { 34, 161, 36, 161 }, { 32, 162, 35, 162 }, { 31, 163, 34, 163 }, { 29, 164, 32, 164 }, { 28, 165, 31, 165 }, { 26, 166, 29, 166 },
+    { 25, 167, 28, 167 }, { 23, 168, 26, 168 }, { 22, 169, 25, 169 }, { 20, 170, 24, 170 }, { 19, 171, 22, 172 }, { 38, 157, 38, 157 },
+    { 37, 158, 39, 158 }, { 35, 159, 39, 159 }, { 34, 160, 38, 160 }, { 32, 161, 36, 161 }, { 31, 162, 35, 162 }, { 29, 163, 34, 163 },
+    { 28, 164, 32, 164 }, { 26, 165, 31, 165 }, { 25, 166, 29, 166 }, { 23, 167, 28, 167 }, { 22, 168, 26, 168 }, { 20, 169, 25, 169 },
+    { 19, 170, 24, 170 }, { 18, 171, 22, 172 }, { 37, 157, 38, 157 }, { 35, 158, 39, 158 }, { 34, 159, 39, 159 }, { 32, 160, 38, 160 },
+    { 31, 161, 36, 161 }, { 29, 162, 35, 162 }, { 28, 163, 34, 163 }, { 26, 164, 32, 164 }, { 25, 165, 31, 165 }, { 23, 166, 29, 166 },
+    { 21, 167, 28, 167 }, { 20, 168, 26, 168 }, { 18, 169, 25, 172 }, { 37, 156, 37, 156 }, { 35, 157, 38, 157 }, { 34, 158, 39, 158 },
+    { 32, 159, 39, 159 }, { 31, 160, 38, 160 }, { 29, 161, 36, 161 }, { 28, 162, 35, 162 }, { 26, 163, 34, 163 }, { 24, 164, 32, 164 },
+    { 23, 165, 31, 165 }, { 21, 166, 29, 166 }, { 20, 167, 28, 167 }, { 18, 168, 26, 168 }, { 17, 169, 25, 172 }, { 37, 155, 37, 155 },
+    { 36, 156, 37, 156 }, { 34, 157, 38, 157 }, { 32, 158, 39, 158 }, { 31, 159, 39, 159 }, { 29, 160, 38, 160 }, { 28, 161, 36, 161 },
+    { 26, 162, 35, 162 }, { 24, 163, 34, 163 }, { 23, 164, 32, 164 }, { 21, 165, 31, 165 }, { 20, 166, 29, 166 }, { 18, 167, 28, 167 },
+    { 16, 168, 26, 172 }, { 36, 155, 37, 155 }, { 34, 156, 37, 156 }, { 32, 157, 38, 157 }, { 31, 158, 39, 158 }, { 29, 159, 39, 159 },
+    { 28, 160, 38, 160 }, { 26, 161, 36, 161 }, { 24, 162, 35, 162 }, { 23, 163, 34, 163 }, { 21, 164, 32, 164 }, { 19, 165, 31, 165 },
+    { 18, 166, 29, 166 }, { 16, 167, 28, 172 }, { 36, 154, 36, 154 }, { 34, 155, 37, 155 }, { 33, 156, 37, 156 }, { 31, 157, 38, 157 },
+    { 29, 158, 39, 158 }, { 28, 159, 39, 159 }, { 26, 160, 38, 160 }, { 24, 161, 36, 161 }, { 23, 162, 35, 162 }, { 21, 163, 34, 163 },
+    { 19, 164, 32, 164 }, { 18, 165, 31, 165 }, { 16, 166, 29, 172 }, { 34, 154, 36, 154 }, { 33, 155, 37, 155 }, { 31, 156, 37, 156 },
+    { 29, 157, 38, 157 }, { 28, 158, 39, 158 }, { 26, 159, 39, 159 }, { 24, 160, 38, 160 }, { 23, 161, 36, 161 }, { 21, 162, 35, 162 },
+    { 19, 163, 34, 163 }, { 17, 164, 32, 164 }, { 16, 165, 31, 165 }, { 15, 166, 29, 172 }, { 35, 153, 35, 153 }, { 33, 154, 36, 154 },
+    { 31, 155, 37, 155 }, { 29, 156, 37, 156 }, { 28, 157, 38, 157 }, { 26, 158, 39, 158 }, { 24, 159, 39, 159 }, { 23, 160, 38, 160 },
+    { 21, 161, 36, 161 }, { 19, 162, 35, 162 }, { 17, 163, 34, 163 }, { 16, 164, 32, 164 }, { 14, 165, 31, 172 }, { 35, 152, 35, 152 },
+    { 33, 153, 35, 153 }, { 31, 154, 36, 154 }, { 30, 155, 37, 155 }, { 28, 156, 37, 156 }, { 26, 157, 38, 157 }, { 24, 158, 39, 158 },
+    { 23, 159, 39, 159 }, { 21, 160, 38, 160 }, { 19, 161, 36, 161 }, { 17, 162, 35, 162 }, { 15, 163, 34, 163 }, { 14, 164, 32, 172 },
+    { 33, 152, 35, 152 }, { 32, 153, 35, 153 }, { 30, 154, 36, 154 }, { 28, 155, 37, 155 }, { 26, 156, 37, 156 }, { 24, 157, 38, 157 },
+    { 23, 158, 39, 158 }, { 21, 159, 39, 159 }, { 19, 160, 38, 160 }, { 17, 161, 36, 161 }, { 15, 162, 35, 162 }, { 13, 163, 34, 172 },
+    { 34, 151, 34, 151 }, { 32, 152, 35, 152 }, { 30, 153, 35, 153 }, { 28, 154, 36, 154 }, { 26, 155, 37, 155 }, { 24, 156, 37, 156 },
+    { 23, 157, 38, 157 }, { 21, 158, 39, 158 }, { 19, 159, 39, 159 }, { 17, 160, 38, 160 }, { 15, 161, 36, 161 }, { 13, 162, 35, 172 },
+    { 34, 150, 34, 150 }, { 32, 151, 34, 151 }, { 30, 152, 35, 152 }, { 28, 153, 35, 153 }, { 26, 154, 36, 154 }, { 24, 155, 37, 155 },
+    { 23, 156, 37, 156 }, { 21, 157, 38, 157 }, { 19, 158, 39, 158 }, { 17, 159, 39, 159 }, { 15, 160, 38, 160 }, { 13, 161, 36, 172 },
+    { 32, 150, 34, 150 }, { 30, 151, 34, 151 }, { 28, 152, 35, 152 }, { 26, 153, 35, 153 }, { 25, 154, 36, 154 }, { 23, 155, 37, 155 },
+    { 21, 156, 37, 156 }, { 19, 157, 38, 157 }, { 17, 158, 39, 158 }, { 15, 159, 39, 159 }, { 13, 160, 38, 160 }, { 12, 161, 36, 172 },
+    { 32, 149, 33, 149 }, { 31, 150, 34, 150 }, { 29, 151, 34, 151 }, { 27, 152, 35, 152 }, { 25, 153, 35, 153 }, { 23, 154, 36, 154 },
+    { 21, 155, 37, 155 }, { 19, 156, 37, 156 }, { 17, 157, 38, 157 }, { 15, 158, 39, 158 }, { 13, 159, 39, 159 }, { 12, 160, 38, 172 },
+    { 33, 148, 33, 148 }, { 31, 149, 33, 149 }, { 29, 150, 34, 150 }, { 27, 151, 34, 151 }, { 25, 152, 35, 152 }, { 23, 153, 35, 153 },
+    { 21, 154, 36, 154 }, { 19, 155, 37, 155 }, { 17, 156, 37, 156 }, { 15, 157, 38, 157 }, { 13, 158, 39, 158 }, { 11, 159, 39, 172 },
+    { 31, 148, 33, 148 }, { 29, 149, 33, 149 }, { 27, 150, 34, 150 }, { 25, 151, 34, 151 }, { 23, 152, 35, 152 }, { 21, 153, 35, 153 },
+    { 19, 154, 36, 154 }, { 17, 155, 37, 155 }, { 15, 156, 37, 156 }, { 13, 157, 38, 157 }, { 11, 158, 39, 172 }, { 31, 147, 32, 147 },
+    { 29, 148, 33, 148 }, { 27, 149, 33, 149 }, { 25, 150, 34, 150 }, { 23, 151, 34, 151 }, { 21, 152, 35, 152 }, { 19, 153, 35, 153 },
+    { 17, 154, 36, 154 }, { 15, 155, 37, 155 }, { 13, 156, 37, 156 }, { 10, 157, 39, 172 }, { 32, 146, 32, 146 }, { 30, 147, 32, 147 },
+    { 27, 148, 33, 148 }, { 25, 149, 33, 149 }, { 23, 150, 34, 150 }, { 21, 151, 34, 151 }, { 19, 152, 35, 152 }, { 17, 153, 35, 153 },
+    { 15, 154, 36, 154 }, { 12, 155, 37, 155 }, { 10, 156, 39, 172 }, { 30, 146, 32, 146 }, { 28, 147, 32, 147 }, { 26, 148, 33, 148 },
+    { 23, 149, 33, 149 }, { 21, 150, 34, 150 }, { 19, 151, 34, 151 }, { 17, 152, 35, 152 }, { 15, 153, 35, 153 }, { 12, 154, 36, 154 },
+    { 10, 155, 39, 172 }, { 30, 145, 31, 145 }, { 28, 146, 32, 146 }, { 26, 147, 32, 147 }, { 24, 148, 33, 148 }, { 21, 149, 33, 149 },
+    { 19, 150, 34, 150 }, { 17, 151, 34, 151 }, { 15, 152, 35, 152 }, { 12, 153, 35, 153 }, { 10, 154, 36, 154 }, { 9, 155, 39, 172 },
+    { 31, 144, 31, 144 }, { 28, 145, 31, 145 }, { 26, 146, 32, 146 }, { 24, 147, 32, 147 }, { 21, 148, 33, 148 }, { 19, 149, 33, 149 },
+    { 17, 150, 34, 150 }, { 15, 151, 34, 151 }, { 12, 152, 35, 152 }, { 10, 153, 35, 153 }, { 9, 154, 39, 172 }, { 29, 144, 31, 144 },
+    { 26, 145, 31, 145 }, { 24, 146, 32, 146 }, { 22, 147, 32, 147 }, { 19, 148, 33, 148 }, { 17, 149, 33, 149 }, { 15, 150, 34, 150 },
+    { 12, 151, 34, 151 }, { 10, 152, 35, 152 }, { 8, 153, 39, 172 }, { 29, 143, 30, 143 }, { 27, 144, 31, 144 }, { 24, 145, 31, 145 },
+    { 22, 146, 32, 146 }, { 19, 147, 32, 147 }, { 17, 148, 33, 148 }, { 15, 149, 33, 149 }, { 12, 150, 34, 150 }, { 10, 151, 34, 151 },
+    { 8, 152, 39, 172 }, { 30, 142, 30, 142 }, { 27, 143, 30, 143 }, { 25, 144, 31, 144 }, { 22, 145, 31, 145 }, { 20, 146, 32, 146 },
+    { 17, 147, 32, 147 }, { 15, 148, 33, 148 }, { 12, 149, 33, 149 }, { 10, 150, 34, 150 }, { 8, 151, 39, 172 }, { 30, 141, 30, 141 },
+    { 27, 142, 30, 142 }, { 25, 143, 30, 143 }, { 22, 144, 31, 144 }, { 20, 145, 31, 145 }, { 17, 146, 32, 146 }, { 15, 147, 32, 147 },
+    { 12, 148, 33, 148 }, { 10, 149, 33, 149 }, { 7, 150, 39, 172 }, { 28, 141, 30, 141 }, { 25, 142, 30, 142 }, { 23, 143, 30, 143 },
+    { 20, 144, 31, 144 }, { 18, 145, 31, 145 }, { 15, 146, 32, 146 }, { 12, 147, 32, 147 }, { 10, 148, 33, 148 }, { 7, 149, 39, 172 },
+    { 28, 140, 29, 140 }, { 26, 141, 30, 141 }, { 23, 142, 30, 142 }, { 20, 143, 30, 143 }, { 18, 144, 31, 144 }, { 15, 145, 31, 145 },
+    { 12, 146, 32, 146 }, { 10, 147, 32, 147 }, { 7, 148, 39, 172 }, { 29, 139, 29, 139 }, { 26, 140, 29, 140 }, { 23, 141, 30, 141 },
+    { 21, 142, 30, 142 }, { 18, 143, 30, 143 }, { 15, 144, 31, 144 }, { 12, 145, 31, 145 }, { 10, 146, 32, 146 }, { 7, 147, 32, 147 },
+    { 6, 148, 39, 172 }, { 27, 139, 29, 139 }, { 24, 140, 29, 140 }, { 21, 141, 30, 141 }, { 18, 142, 30, 142 }, { 15, 143, 30, 143 },
+    { 13, 144, 31, 144 }, { 10, 145, 31, 145 }, { 7, 146, 32, 146 }, { 6, 147, 39, 172 }, { 27, 138, 28, 138 }, { 24, 139, 29, 139 },
+    { 21, 140, 29, 140 }, { 19, 141, 30, 141 }, { 16, 142, 30, 142 }, { 13, 143, 30, 143 }, { 10, 144, 31, 144 }, { 7, 145, 31, 145 },
+    { 6, 146, 39, 172 }, { 28, 137, 28, 137 }, { 25, 138, 28, 138 }, { 22, 139, 29, 139 }, { 19, 140, 29, 140 }, { 16, 141, 30, 141 },
+    { 13, 142, 30, 142 }, { 10, 143, 30, 143 }, { 7, 144, 31, 144 }, { 5, 145, 39, 172 }, { 28, 136, 28, 136 }, { 25, 137, 28, 137 },
+    { 22, 138, 28, 138 }, { 19, 139, 29, 139 }, { 16, 140, 29, 140 }, { 13, 141, 30, 141 }, { 10, 142, 30, 142 }, { 7, 143, 30, 143 },
+    { 5, 144, 39, 172 }, { 26, 136, 28, 136 }, { 23, 137, 28, 137 }, { 20, 138, 28, 138 }, { 16, 139, 29, 139 }, { 13, 140, 29, 140 },
+    { 10, 141, 30, 141 }, { 7, 142, 30, 142 }, { 5, 143, 39, 172 }, { 27, 135, 27, 135 }, { 23, 136, 28, 136 }, { 20, 137, 28, 137 },
+    { 17, 138, 28, 138 }, { 14, 139, 29, 139 }, { 10, 140, 29, 140 }, { 7, 141, 30, 141 }, { 4, 142, 39, 172 }, { 27, 134, 27, 134 },
+    { 24, 135, 27, 135 }, { 21, 136, 28, 136 }, { 17, 137, 28, 137 }, { 14, 138, 28, 138 }, { 10, 139, 29, 139 }, { 7, 140, 29, 140 },
+    { 4, 141, 39, 172 }, { 25, 134, 27, 134 }, { 21, 135, 27, 135 }, { 18, 136, 28, 136 }, { 14, 137, 28, 137 }, { 11, 138, 28, 138 },
+    { 7, 139, 29, 139 }, { 4, 140, 39, 172 }, { 25, 133, 27, 133 }, { 22, 134, 27, 134 }, { 18, 135, 27, 135 }, { 14, 136, 28, 136 },
+    { 11, 137, 28, 137 }, { 7, 138, 28, 138 }, { 4, 139, 39, 172 }, { 26, 132, 26, 132 }, { 22, 133, 27, 133 }, { 19, 134, 27, 134 },
+    { 15, 135, 27, 135 }, { 11, 136, 28, 136 }, { 7, 137, 28, 137 }, { 4, 138, 39, 172 }, { 23, 132, 26, 132 }, { 19, 133, 27, 133 },
+    { 15, 134, 27, 134 }, { 11, 135, 27, 135 }, { 8, 136, 28, 136 }, { 4, 137, 28, 137 }, { 3, 138, 39, 172 }, { 24, 131, 26, 131 },
+    { 20, 132, 26, 132 }, { 16, 133, 27, 133 }, { 12, 134, 27, 134 }, { 8, 135, 27, 135 }, { 4, 136, 28, 136 }, { 3, 137, 39, 172 },
+    { 25, 130, 26, 130 }, { 20, 131, 26, 131 }, { 16, 132, 26, 132 }, { 12, 133, 27, 133 }, { 8, 134, 27, 134 }, { 4, 135, 27, 135 },
+    { 3, 136, 39, 172 }, { 26, 129, 26, 129 }, { 21, 130, 26, 130 }, { 17, 131, 26, 131 }, { 13, 132, 26, 132 }, { 8, 133, 27, 133 },
+    { 4, 134, 27, 134 }, { 3, 135, 39, 172 }, { 22, 129, 26, 129 }, { 18, 130, 26, 130 }, { 13, 131, 26, 131 }, { 9, 132, 26, 132 },
+    { 4, 133, 27, 133 }, { 2, 134, 39, 172 }, { 23, 128, 25, 128 }, { 18, 129, 26, 129 }, { 14, 130, 26, 130 }, { 9, 131, 26, 131 },
+    { 4, 132, 26, 132 }, { 2, 133, 39, 172 }, { 24, 127, 25, 127 }, { 19, 128, 25, 128 }, { 14, 129, 26, 129 }, { 9, 130, 26, 130 },
+    { 4, 131, 26, 131 }, { 2, 132, 39, 172 }, { 25, 126, 25, 126 }, { 20, 127, 25, 127 }, { 15, 128, 25, 128 }, { 10, 129, 26, 129 },
+    { 5, 130, 26, 130 }, { 2, 131, 39, 172 }, { 21, 126, 25, 126 }, { 16, 127, 25, 127 }, { 10, 128, 25, 128 }, { 5, 129, 26, 129 },
+    { 1, 130, 39, 172 }, { 22, 125, 25, 125 }, { 16, 126, 25, 126 }, { 11, 127, 25, 127 }, { 5, 128, 25, 128 }, { 1, 129, 39, 172 },
+    { 23, 124, 25, 124 }, { 17, 125, 25, 125 }, { 11, 126, 25, 126 }, { 5, 127, 25, 127 }, { 1, 128, 39, 172 }, { 25, 123, 25, 123 },
+    { 18, 124, 25, 124 }, { 12, 125, 25, 125 }, { 6, 126, 25, 126 }, { 1, 127, 39, 172 }, { 20, 123, 25, 123 }, { 13, 124, 25, 124 },
+    { 6, 125, 25, 125 }, { 1, 126, 39, 172 }, { 21, 122, 24, 122 }, { 14, 123, 25, 123 }, { 7, 124, 25, 124 }, { 1, 125, 39, 172 },
+    { 23, 121, 24, 121 }, { 15, 122, 24, 122 }, { 7, 123, 25, 123 }, { 1, 124, 39, 172 }, { 24, 120, 24, 120 }, { 16, 121, 24, 121 },
+    { 8, 122, 24, 122 }, { 0, 123, 39, 172 }, { 18, 120, 24, 120 }, { 9, 121, 24, 121 }, { 0, 122, 39, 172 }, { 20, 119, 24, 119 },
+    { 10, 120, 24, 120 }, { 1, 121, 24, 121 }, { 0, 122, 39, 172 }, { 22, 118, 24, 118 }, { 11, 119, 24, 119 }, { 1, 120, 24, 120 },
+    { 0, 121, 39, 172 }, { 24, 117, 24, 117 }, { 13, 118, 24, 118 }, { 1, 119, 24, 119 }, { 0, 120, 39, 172 }, { 15, 117, 24, 117 },
+    { 2, 118, 24, 118 }, { 0, 119, 39, 172 }, { 17, 116, 24, 116 }, { 3, 117, 24, 117 }, { 0, 118, 39, 172 }, { 20, 115, 24, 115 },
+    { 4, 116, 24, 116 }, { 0, 117, 39, 172 }, { 24, 114, 24, 114 }, { 5, 115, 24, 115 }, { 0, 116, 39, 172 }, { 7, 114, 24, 114 },
+    { 0, 115, 39, 172 }, { 10, 113, 23, 113 }, { 0, 114, 39, 172 }, { 15, 112, 23, 112 }, { 0, 113, 39, 172 }, { 0, 112, 39, 172 },
+    { 0, 111, 39, 172 }, { 0, 110, 39, 172 }, { 0, 109, 39, 172 }, { 0, 108, 39, 172 }, { 0, 107, 14, 107 }, { 0, 108, 39, 172 },
+    { 0, 106, 9, 106 }, { 0, 107, 39, 172 }, { 0, 105, 6, 105 }, { 0, 106, 39, 172 }, { 0, 104, 4, 104 }, { 0, 105, 23, 113 },
+    { 0, 114, 39, 172 }, { 0, 103, 3, 103 }, { 0, 104, 19, 104 }, { 0, 105, 39, 172 }, { 0, 102, 2, 102 }, { 0, 103, 16, 103 },
+    { 0, 104, 39, 172 }, { 0, 101, 1, 101 }, { 0, 102, 14, 102 }, { 0, 103, 39, 172 }, { 0, 100, 0, 100 }, { 0, 101, 12, 101 },
+    { 0, 102, 23, 102 }, { 0, 103, 39, 172 }, { 0, 99, 0, 99 }, { 0, 100, 10, 100 }, { 0, 101, 21, 101 }, { 0, 102, 39, 172 },
+    { 0, 98, 0, 98 }, { 0, 99, 9, 99 }, { 0, 100, 19, 100 }, { 0, 101, 39, 172 }, { 0, 98, 8, 98 }, { 0, 99, 17, 99 },
+    { 0, 100, 39, 172 }, { 0, 97, 7, 97 }, { 0, 98, 15, 98 }, { 0, 99, 23, 99 }, { 0, 100, 39, 172 }, { 0, 96, 6, 96 },
+    { 0, 97, 14, 97 }, { 0, 98, 22, 98 }, { 0, 99, 39, 172 }, { 1, 95, 6, 95 }, { 0, 96, 13, 96 }, { 0, 97, 20, 97 },
+    { 0, 98, 39, 172 }, { 1, 94, 5, 94 }, { 1, 95, 12, 95 }, { 0, 96, 19, 96 }, { 0, 97, 39, 172 }, { 1, 93, 5, 93 },
+    { 1, 94, 11, 94 }, { 1, 95, 17, 95 }, { 0, 96, 24, 122 }, { 0, 123, 39, 172 }, { 1, 92, 4, 92 }, { 1, 93, 10, 93 },
+    { 1, 94, 16, 94 }, { 1, 95, 22, 95 }, { 0, 96, 39, 172 }, { 1, 91, 4, 91 }, { 1, 92, 10, 92 }, { 1, 93, 15, 93 },
+    { 1, 94, 21, 94 }, { 0, 95, 39, 172 }, { 1, 90, 4, 90 }, { 1, 91, 9, 91 }, { 1, 92, 15, 92 }, { 1, 93, 20, 93 },
+    { 0, 94, 39, 172 }, { 1, 89, 4, 89 }, { 1, 90, 9, 90 }, { 1, 91, 14, 91 }, { 1, 92, 19, 92 }, { 1, 93, 24, 93 },
+    { 0, 94, 39, 172 }, { 2, 88, 3, 88 }, { 1, 89, 8, 89 }, { 1, 90, 13, 90 }, { 1, 91, 18, 91 }, { 1, 92, 23, 92 },
+    { 0, 93, 39, 172 }, { 2, 87, 3, 87 }, { 2, 88, 8, 88 }, { 1, 89, 13, 89 }, { 1, 90, 17, 90 }, { 1, 91, 22, 91 },
+    { 0, 92, 39, 172 }, { 2, 86, 3, 86 }, { 2, 87, 8, 87 }, { 2, 88, 12, 88 }, { 1, 89, 17, 89 }, { 1, 90, 21, 90 },
+    { 0, 91, 39, 172 }, { 2, 85, 3, 85 }, { 2, 86, 7, 86 }, { 2, 87, 12, 87 }, { 2, 88, 16, 88 }, { 1, 89, 20, 89 },
+    { 0, 90, 25, 128 }, { 1, 129, 39, 172 }, { 3, 84, 3, 84 }, { 2, 85, 7, 85 }, { 2, 86, 11, 86 }, { 2, 87, 15, 87 },
+    { 2, 88, 19, 88 }, { 1, 89, 24, 89 }, { 0, 90, 39, 172 }, { 3, 83, 3, 83 }, { 3, 84, 7, 84 }, { 2, 85, 11, 85 },
+    { 2, 86, 15, 86 }, { 2, 87, 19, 87 }, { 2, 88, 23, 88 }, { 0, 89, 39, 172 }, { 3, 82, 3, 82 }, { 3, 83, 7, 83 },
+    { 3, 84, 10, 84 }, { 2, 85, 14, 85 }, { 2, 86, 18, 86 }, { 2, 87, 22, 87 }, { 0, 88, 39, 172 }, { 3, 81, 3, 81 },
+    { 3, 82, 6, 82 }, { 3, 83, 10, 83 }, { 3, 84, 14, 84 }, { 2, 85, 18, 85 }, { 2, 86, 21, 86 }, { 2, 87, 25, 87 },
+    { 0, 88, 39, 172 }, { 3, 81, 6, 81 }, { 3, 82, 10, 82 }, { 3, 83, 13, 83 }, { 3, 84, 17, 84 }, { 2, 85, 21, 85 },
+    { 2, 86, 24, 86 }, { 0, 87, 39, 172 }, { 4, 80, 6, 80 }, { 3, 81, 10, 81 }, { 3, 82, 13, 82 }, { 3, 83, 17, 83 },
+    { 3, 84, 20, 84 }, { 2, 85, 24, 85 }, { 0, 86, 39, 172 }, { 4, 79, 6, 79 }, { 4, 80, 9, 80 }, { 3, 81, 13, 81 },
+    { 3, 82, 16, 82 }, { 3, 83, 20, 83 }, { 3, 84, 23, 84 }, { 2, 85, 26, 85 }, { 0, 86, 39, 172 }, { 4, 78, 6, 78 },
+    { 4, 79, 9, 79 }, { 4, 80, 13, 80 }, { 3, 81, 16, 81 }, { 3, 82, 19, 82 }, { 3, 83, 22, 83 }, { 3, 84, 26, 84 },
+    { 0, 85, 39, 172 }, { 4, 77, 6, 77 }, { 4, 78, 9, 78 }, { 4, 79, 12, 79 }, { 4, 80, 15, 80 }, { 3, 81, 19, 81 },
+    { 3, 82, 22, 82 }, { 3, 83, 25, 83 }, { 0, 84, 39, 172 }, { 5, 76, 6, 76 }, { 4, 77, 9, 77 }, { 4, 78, 12, 78 },
+    { 4, 79, 15, 79 }, { 4, 80, 18, 80 }, { 3, 81, 21, 81 }, { 3, 82, 24, 82 }, { 0, 83, 27, 135 }, { 3, 136, 39, 172 },
+    { 5, 75, 6, 75 }, { 5, 76, 9, 76 }, { 4, 77, 12, 77 }, { 4, 78, 15, 78 }, { 4, 79, 18, 79 }, { 4, 80, 21, 80 },
+    { 3, 81, 24, 81 }, { 3, 82, 27, 82 }, { 0, 83, 39, 172 }, { 5, 74, 6, 74 }, { 5, 75, 9, 75 }, { 5, 76, 12, 76 },
+    { 4, 77, 15, 77 }, { 4, 78, 18, 78 }, { 4, 79, 20, 79 }, { 4, 80, 23, 80 }, { 3, 81, 26, 81 }, { 0, 82, 39, 172 },
+    { 6, 73, 6, 73 }, { 5, 74, 9, 74 }, { 5, 75, 12, 75 }, { 5, 76, 14, 76 }, { 4, 77, 17, 77 }, { 4, 78, 20, 78 },
+    { 4, 79, 23, 79 }, { 4, 80, 26, 80 }, { 0, 81, 39, 172 }, { 6, 72, 6, 72 }, { 6, 73, 9, 73 }, { 5, 74, 11, 74 },
+    { 5, 75, 14, 75 }, { 5, 76, 17, 76 }, { 4, 77, 20, 77 }, { 4, 78, 22, 78 }, { 4, 79, 25, 79 }, { 0, 80, 28, 138 },
+    { 4, 139, 39, 172 }, { 6, 71, 6, 71 }, { 6, 72, 9, 72 }, { 6, 73, 11, 73 }, { 5, 74, 14, 74 }, { 5, 75, 17, 75 },
+    { 5, 76, 19, 76 }, { 4, 77, 22, 77 }, { 4, 78, 25, 78 }, { 4, 79, 27, 79 }, { 0, 80, 39, 172 }, { 6, 71, 9, 71 },
+    { 6, 72, 11, 72 }, { 6, 73, 14, 73 }, { 5, 74, 17, 74 }, { 5, 75, 19, 75 }, { 5, 76, 22, 76 }, { 4, 77, 24, 77 },
+    { 4, 78, 27, 78 }, { 0, 79, 39, 172 }, { 7, 70, 9, 70 }, { 6, 71, 11, 71 }, { 6, 72, 14, 72 }, { 6, 73, 16, 73 },
+    { 5, 74, 19, 74 }, { 5, 75, 21, 75 }, { 5, 76, 24, 76 }, { 4, 77, 26, 77 }, { 0, 78, 29, 140 }, { 4, 141, 39, 172 },
+    { 7, 69, 9, 69 }, { 7, 70, 11, 70 }, { 6, 71, 14, 71 }, { 6, 72, 16, 72 }, { 6, 73, 19, 73 }, { 5, 74, 21, 74 },
+    { 5, 75, 24, 75 }, { 5, 76, 26, 76 }, { 4, 77, 29, 77 }, { 0, 78, 39, 172 }, { 8, 68, 9, 68 }, { 7, 69, 11, 69 },
+    { 7, 70, 14, 70 }, { 6, 71, 16, 71 }, { 6, 72, 18, 72 }, { 6, 73, 21, 73 }, { 5, 74, 23, 74 }, { 5, 75, 26, 75 },
+    { 5, 76, 28, 76 }, { 0, 77, 39, 172 }, { 8, 67, 9, 67 }, { 8, 68, 11, 68 }, { 7, 69, 14, 69 }, { 7, 70, 16, 70 },
+    { 6, 71, 18, 71 }, { 6, 72, 21, 72 }, { 6, 73, 23, 73 }, { 5, 74, 25, 74 }, { 5, 75, 28, 75 }, { 0, 76, 39, 172 },
+    { 8, 66, 9, 66 }, { 8, 67, 11, 67 }, { 8, 68, 14, 68 }, { 7, 69, 16, 69 }, { 7, 70, 18, 70 }, { 6, 71, 20, 71 },
+    { 6, 72, 23, 72 }, { 6, 73, 25, 73 }, { 5, 74, 27, 74 }, { 0, 75, 30, 143 }, { 5, 144, 39, 172 }, { 9, 65, 9, 65 },
+    { 8, 66, 11, 66 }, { 8, 67, 14, 67 }, { 8, 68, 16, 68 }, { 7, 69, 18, 69 }, { 7, 70, 20, 70 }, { 6, 71, 23, 71 },
+    { 6, 72, 25, 72 }, { 6, 73, 27, 73 }, { 5, 74, 29, 74 }, { 0, 75, 39, 172 }, { 9, 64, 9, 64 }, { 9, 65, 11, 65 },
+    { 8, 66, 14, 66 }, { 8, 67, 16, 67 }, { 8, 68, 18, 68 }, { 7, 69, 20, 69 }, { 7, 70, 22, 70 }, { 6, 71, 25, 71 },
+    { 6, 72, 27, 72 }, { 6, 73, 29, 73 }, { 0, 74, 39, 172 }, { 9, 64, 11, 64 }, { 9, 65, 14, 65 }, { 8, 66, 16, 66 },
+    { 8, 67, 18, 67 }, { 8, 68, 20, 68 }, { 7, 69, 22, 69 }, { 7, 70, 24, 70 }, { 6, 71, 26, 71 }, { 6, 72, 29, 72 },
+    { 0, 73, 31, 145 }, { 6, 146, 39, 172 }, { 10, 63, 12, 63 }, { 9, 64, 14, 64 }, { 9, 65, 16, 65 }, { 8, 66, 18, 66 },
+    { 8, 67, 20, 67 }, { 8, 68, 22, 68 }, { 7, 69, 24, 69 }, { 7, 70, 26, 70 }, { 6, 71, 28, 71 }, { 6, 72, 30, 72 },
+    { 0, 73, 39, 172 }, { 10, 62, 12, 62 }, { 10, 63, 14, 63 }, { 9, 64, 16, 64 }, { 9, 65, 18, 65 }, { 8, 66, 20, 66 },
+    { 8, 67, 22, 67 }, { 8, 68, 24, 68 }, { 7, 69, 26, 69 }, { 7, 70, 28, 70 }, { 6, 71, 30, 71 }, { 0, 72, 39, 172 },
+    { 11, 61, 12, 61 }, { 10, 62, 14, 62 }, { 10, 63, 16, 63 }, { 9, 64, 18, 64 }, { 9, 65, 20, 65 }, { 8, 66, 22, 66 },
+    { 8, 67, 24, 67 }, { 8, 68, 26, 68 }, { 7, 69, 28, 69 }, { 7, 70, 30, 70 }, { 0, 71, 32, 147 }, { 6, 148, 39, 172 },
+    { 11, 60, 12, 60 }, { 11, 61, 14, 61 }, { 10, 62, 16, 62 }, { 10, 63, 18, 63 }, { 9, 64, 20, 64 }, { 9, 65, 22, 65 },
+    { 8, 66, 24, 66 }, { 8, 67, 26, 67 }, { 8, 68, 28, 68 }, { 7, 69, 30, 69 }, { 7, 70, 31, 70 }, { 0, 71, 39, 172 },
+    { 12, 59, 12, 59 }, { 11, 60, 14, 60 }, { 11, 61, 16, 61 }, { 10, 62, 18, 62 }, { 10, 63, 20, 63 }, { 9, 64, 22, 64 },
+    { 9, 65, 24, 65 }, { 8, 66, 25, 66 }, { 8, 67, 27, 67 }, { 8, 68, 29, 68 }, { 7, 69, 31, 69 }, { 0, 70, 39, 172 },
+    { 12, 58, 12, 58 }, { 12, 59, 14, 59 }, { 11, 60, 16, 60 }, { 11, 61, 18, 61 }, { 10, 62, 20, 62 }, { 10, 63, 22, 63 },
+    { 9, 64, 23, 64 }, { 9, 65, 25, 65 }, { 8, 66, 27, 66 }, { 8, 67, 29, 67 }, { 8, 68, 31, 68 }, { 0, 69, 33, 149 },
+    { 7, 150, 39, 172 }, { 12, 58, 14, 58 }, { 12, 59, 16, 59 }, { 11, 60, 18, 60 }, { 11, 61, 20, 61 }, { 10, 62, 22, 62 },
+    { 10, 63, 23, 63 }, { 9, 64, 25, 64 }, { 9, 65, 27, 65 }, { 8, 66, 29, 66 }, { 8, 67, 31, 67 }, { 8, 68, 33, 68 },
+    { 0, 69, 39, 172 }, { 13, 57, 14, 57 }, { 12, 58, 16, 58 }, { 12, 59, 18, 59 }, { 11, 60, 20, 60 }, { 11, 61, 22, 61 },
+    { 10, 62, 23, 62 }, { 10, 63, 25, 63 }, { 9, 64, 27, 64 }, { 9, 65, 29, 65 }, { 8, 66, 31, 66 }, { 8, 67, 32, 67 },
+    { 0, 68, 39, 172 }, { 13, 56, 14, 56 }, { 13, 57, 16, 57 }, { 12, 58, 18, 58 }, { 12, 59, 20, 59 }, { 11, 60, 22, 60 },
+    { 11, 61, 23, 61 }, { 10, 62, 25, 62 }, { 10, 63, 27, 63 }, { 9, 64, 29, 64 }, { 9, 65, 30, 65 }, { 8, 66, 32, 66 },
+    { 0, 67, 34, 151 }, { 8, 152, 39, 172 }, { 14, 55, 15, 55 }, { 13, 56, 16, 56 }, { 13, 57, 18, 57 }, { 12, 58, 20, 58 },
+    { 12, 59, 22, 59 }, { 11, 60, 23, 60 }, { 11, 61, 25, 61 }, { 10, 62, 27, 62 }, { 10, 63, 28, 63 }, { 9, 64, 30, 64 },
+    { 9, 65, 32, 65 }, { 8, 66, 34, 66 }, { 0, 67, 39, 172 }, { 14, 54, 15, 54 }, { 14, 55, 16, 55 }, { 13, 56, 18, 56 },
+    { 13, 57, 20, 57 }, { 12, 58, 22, 58 }, { 12, 59, 23, 59 }, { 11, 60, 25, 60 }, { 11, 61, 27, 61 }, { 10, 62, 28, 62 },
+    { 10, 63, 30, 63 }, { 9, 64, 32, 64 }, { 9, 65, 33, 65 }, { 0, 66, 39, 172 }, { 15, 53, 15, 53 }, { 14, 54, 17, 54 },
+    { 14, 55, 18, 55 }, { 13, 56, 20, 56 }, { 13, 57, 22, 57 }, { 12, 58, 23, 58 }, { 12, 59, 25, 59 }, { 11, 60, 27, 60 },
+    { 11, 61, 28, 61 }, { 10, 62, 30, 62 }, { 10, 63, 32, 63 }, { 9, 64, 33, 64 }, { 0, 65, 35, 153 }, { 9, 154, 39, 172 },
+    { 15, 53, 17, 53 }, { 14, 54, 18, 54 }, { 14, 55, 20, 55 }, { 13, 56, 22, 56 }, { 13, 57, 23, 57 }, { 12, 58, 25, 58 },
+    { 12, 59, 27, 59 }, { 11, 60, 28, 60 }, { 11, 61, 30, 61 }, { 10, 62, 31, 62 }, { 10, 63, 33, 63 }, { 9, 64, 35, 64 },
+    { 0, 65, 39, 172 }, { 16, 52, 17, 52 }, { 15, 53, 19, 53 }, { 14, 54, 20, 54 }, { 14, 55, 22, 55 }, { 13, 56, 23, 56 },
+    { 13, 57, 25, 57 }, { 12, 58, 27, 58 }, { 12, 59, 28, 59 }, { 11, 60, 30, 60 }, { 11, 61, 31, 61 }, { 10, 62, 33, 62 },
+    { 10, 63, 35, 63 }, { 0, 64, 36, 154 }, { 9, 155, 39, 172 }, { 16, 51, 17, 51 }, { 16, 52, 19, 52 }, { 15, 53, 20, 53 },
+    { 14, 54, 22, 54 }, { 14, 55, 23, 55 }, { 13, 56, 25, 56 }, { 13, 57, 27, 57 }, { 12, 58, 28, 58 }, { 12, 59, 30, 59 },
+    { 11, 60, 31, 60 }, { 11, 61, 33, 61 }, { 10, 62, 34, 62 }, { 10, 63, 36, 63 }, { 0, 64, 39, 172 }, { 17, 50, 17, 50 },
+    { 16, 51, 19, 51 }, { 16, 52, 20, 52 }, { 15, 53, 22, 53 }, { 14, 54, 24, 54 }, { 14, 55, 25, 55 }, { 13, 56, 27, 56 },
+    { 13, 57, 28, 57 }, { 12, 58, 30, 58 }, { 12, 59, 31, 59 }, { 11, 60, 33, 60 }, { 11, 61, 34, 61 }, { 10, 62, 36, 62 },
+    { 0, 63, 39, 172 }, { 18, 49, 18, 49 }, { 17, 50, 19, 50 }, { 16, 51, 21, 51 }, { 16, 52, 22, 52 }, { 15, 53, 24, 53 },
+    { 14, 54, 25, 54 }, { 14, 55, 27, 55 }, { 13, 56, 28, 56 }, { 13, 57, 30, 57 }, { 12, 58, 31, 58 }, { 12, 59, 33, 59 },
+    { 11, 60, 34, 60 }, { 11, 61, 36, 61 }, { 0, 62, 37, 156 }, { 10, 157, 39, 172 }, { 18, 48, 18, 48 }, { 18, 49, 19, 49 },
+    { 17, 50, 21, 50 }, { 16, 51, 22, 51 }, { 16, 52, 24, 52 }, { 15, 53, 25, 53 }, { 14, 54, 27, 54 }, { 14, 55, 28, 55 },
+    { 13, 56, 30, 56 }, { 13, 57, 31, 57 }, { 12, 58, 33, 58 }, { 12, 59, 34, 59 }, { 11, 60, 36, 60 }, { 11, 61, 37, 61 },
+    { 0, 62, 39, 172 }, { 18, 48, 20, 48 }, { 18, 49, 21, 49 }, { 17, 50, 22, 50 }, { 16, 51, 24, 51 }, { 16, 52, 25, 52 },
+    { 15, 53, 27, 53 }, { 14, 54, 28, 54 }, { 14, 55, 30, 55 }, { 13, 56, 31, 56 }, { 13, 57, 33, 57 }, { 12, 58, 34, 58 },
+    { 12, 59, 36, 59 }, { 11, 60, 37, 60 }, { 0, 61, 38, 157 }, { 11, 158, 39, 172 }, { 19, 47, 20, 47 }, { 18, 48, 21, 48 },
+    { 18, 49, 23, 49 }, { 17, 50, 24, 50 }, { 16, 51, 25, 51 }, { 16, 52, 27, 52 }, { 15, 53, 28, 53 }, { 14, 54, 30, 54 },
+    { 14, 55, 31, 55 }, { 13, 56, 33, 56 }, { 13, 57, 34, 57 }, { 12, 58, 35, 58 }, { 12, 59, 37, 59 }, { 11, 60, 38, 60 },
+    { 0, 61, 39, 172 }, { 20, 46, 20, 46 }, { 19, 47, 21, 47 }, { 18, 48, 23, 48 }, { 18, 49, 24, 49 }, { 17, 50, 26, 50 },
+    { 16, 51, 27, 51 }, { 16, 52, 28, 52 }, { 15, 53, 30, 53 }, { 14, 54, 31, 54 }, { 14, 55, 33, 55 }, { 13, 56, 34, 56 },
+    { 13, 57, 35, 57 }, { 12, 58, 37, 58 }, { 12, 59, 38, 59 }, { 0, 60, 39, 172 }, { 20, 45, 20, 45 }, { 20, 46, 22, 46 },
+    { 19, 47, 23, 47 }, { 18, 48, 24, 48 }, { 18, 49, 26, 49 }, { 17, 50, 27, 50 }, { 16, 51, 28, 51 }, { 16, 52, 30, 52 },
+    { 15, 53, 31, 53 }, { 14, 54, 33, 54 }, { 14, 55, 34, 55 }, { 13, 56, 35, 56 }, { 13, 57, 37, 57 }, { 12, 58, 38, 58 },
+    { 0, 59, 39, 172 }, { 20, 45, 22, 45 }, { 20, 46, 23, 46 }, { 19, 47, 25, 47 }, { 18, 48, 26, 48 }, { 18, 49, 27, 49 },
+    { 17, 50, 29, 50 }, { 16, 51, 30, 51 }, { 16, 52, 31, 52 }, { 15, 53, 33, 53 }, { 14, 54, 34, 54 }, { 14, 55, 35, 55 },
+    { 13, 56, 37, 56 }, { 13, 57, 38, 57 }, { 12, 58, 39, 58 }, { 0, 59, 40, 172 }, { 21, 44, 22, 44 }, { 20, 45, 23, 45 },
+    { 20, 46, 25, 46 }, { 19, 47, 26, 47 }, { 18, 48, 27, 48 }, { 18, 49, 29, 49 }, { 17, 50, 30, 50 }, { 16, 51, 31, 51 },
+    { 16, 52, 33, 52 }, { 15, 53, 34, 53 }, { 14, 54, 35, 54 }, { 14, 55, 37, 55 }, { 13, 56, 38, 56 }, { 13, 57, 39, 57 },
+    { 0, 58, 41, 172 }, { 22, 43, 22, 43 }, { 21, 44, 24, 44 }, { 20, 45, 25, 45 }, { 20, 46, 26, 46 }, { 19, 47, 28, 47 },
+    { 18, 48, 29, 48 }, { 18, 49, 30, 49 }, { 17, 50, 31, 50 }, { 16, 51, 33, 51 }, { 16, 52, 34, 52 }, { 15, 53, 35, 53 },
+    { 14, 54, 37, 54 }, { 14, 55, 38, 55 }, { 13, 56, 39, 56 }, { 0, 57, 41, 172 }, { 22, 42, 23, 42 }, { 22, 43, 24, 43 },
+    { 21, 44, 25, 44 }, { 20, 45, 26, 45 }, { 20, 46, 28, 46 }, { 19, 47, 29, 47 }, { 18, 48, 30, 48 }, { 18, 49, 32, 49 },
+    { 17, 50, 33, 50 }, { 16, 51, 34, 51 }, { 16, 52, 35, 52 }, { 15, 53, 37, 53 }, { 14, 54, 38, 54 }, { 14, 55, 39, 55 },
+    { 13, 56, 41, 56 }, { 0, 57, 42, 172 }, { 23, 41, 23, 41 }, { 22, 42, 24, 42 }, { 22, 43, 25, 43 }, { 21, 44, 27, 44 },
+    { 20, 45, 28, 45 }, { 20, 46, 29, 46 }, { 19, 47, 30, 47 }, { 18, 48, 32, 48 }, { 18, 49, 33, 49 }, { 17, 50, 34, 50 },
+    { 16, 51, 35, 51 }, { 16, 52, 37, 52 }, { 15, 53, 38, 53 }, { 14, 54, 39, 54 }, { 14, 55, 40, 55 }, { 0, 56, 42, 172 },
+    { 23, 41, 24, 41 }, { 22, 42, 26, 42 }, { 22, 43, 27, 43 }, { 21, 44, 28, 44 }, { 20, 45, 29, 45 }, { 20, 46, 31, 46 },
+    { 19, 47, 32, 47 }, { 18, 48, 33, 48 }, { 18, 49, 34, 49 }, { 17, 50, 36, 50 }, { 16, 51, 37, 51 }, { 16, 52, 38, 52 },
+    { 15, 53, 39, 53 }, { 14, 54, 40, 54 }, { 0, 55, 42, 172 }, { 24, 40, 25, 40 }, { 23, 41, 26, 41 }, { 22, 42, 27, 42 },
+    { 22, 43, 28, 43 }, { 21, 44, 30, 44 }, { 20, 45, 31, 45 }, { 20, 46, 32, 46 }, { 19, 47, 33, 47 }, { 18, 48, 34, 48 },
+    { 18, 49, 36, 49 }, { 17, 50, 37, 50 }, { 16, 51, 38, 51 }, { 16, 52, 39, 52 }, { 15, 53, 40, 53 }, { 14, 54, 42, 54 },
+    { 0, 55, 43, 172 }, { 25, 39, 25, 39 }, { 24, 40, 26, 40 }, { 23, 41, 27, 41 }, { 22, 42, 29, 42 }, { 22, 43, 30, 43 },
+    { 21, 44, 31, 44 }, { 20, 45, 32, 45 }, { 20, 46, 33, 46 }, { 19, 47, 35, 47 }, { 18, 48, 36, 48 }, { 18, 49, 37, 49 },
+    { 17, 50, 38, 50 }, { 16, 51, 39, 51 }, { 16, 52, 40, 52 }, { 15, 53, 42, 53 }, { 0, 54, 43, 172 }, { 25, 39, 26, 39 },
+    { 24, 40, 28, 40 }, { 23, 41, 29, 41 }, { 22, 42, 30, 42 }, { 22, 43, 31, 43 }, { 21, 44, 32, 44 }, { 20, 45, 33, 45 },
+    { 20, 46, 35, 46 }, { 19, 47, 36, 47 }, { 18, 48, 37, 48 }, { 18, 49, 38, 49 }, { 17, 50, 39, 50 }, { 16, 51, 41, 51 },
+    { 16, 52, 42, 52 }, { 15, 53, 43, 53 }, { 0, 54, 44, 172 }, { 26, 38, 27, 38 }, { 25, 39, 28, 39 }, { 24, 40, 29, 40 },
+    { 23, 41, 30, 41 }, { 22, 42, 31, 42 }, { 22, 43, 33, 43 }, { 21, 44, 34, 44 }, { 20, 45, 35, 45 }, { 20, 46, 36, 46 },
+    { 19, 47, 37, 47 }, { 18, 48, 38, 48 }, { 18, 49, 39, 49 }, { 17, 50, 41, 50 }, { 16, 51, 42, 51 }, { 16, 52, 43, 52 },
+    { 0, 53, 44, 172 }, { 27, 37, 27, 37 }, { 26, 38, 28, 38 }, { 25, 39, 29, 39 }, { 24, 40, 30, 40 }, { 23, 41, 32, 41 },
+    { 22, 42, 33, 42 }, { 22, 43, 34, 43 }, { 21, 44, 35, 44 }, { 20, 45, 36, 45 }, { 20, 46, 37, 46 }, { 19, 47, 38, 47 },
+    { 18, 48, 39, 48 }, { 18, 49, 41, 49 }, { 17, 50, 42, 50 }, { 16, 51, 43, 51 }, { 16, 52, 44, 52 }, { 0, 53, 45, 172 },
+    { 27, 36, 27, 36 }, { 27, 37, 28, 37 }, { 26, 38, 30, 38 }, { 25, 39, 31, 39 }, { 24, 40, 32, 40 }, { 23, 41, 33, 41 },
+    { 22, 42, 34, 42 }, { 22, 43, 35, 43 }, { 21, 44, 36, 44 }, { 20, 45, 37, 45 }, { 20, 46, 38, 46 }, { 19, 47, 40, 47 },
+    { 18, 48, 41, 48 }, { 18, 49, 42, 49 }, { 17, 50, 43, 50 }, { 16, 51, 44, 51 }, { 0, 52, 45, 172 }, { 28, 35, 28, 35 },
+    { 27, 36, 29, 36 }, { 27, 37, 30, 37 }, { 26, 38, 31, 38 }, { 25, 39, 32, 39 }, { 24, 40, 33, 40 }, { 23, 41, 34, 41 },
+    { 22, 42, 35, 42 }, { 22, 43, 36, 43 }, { 21, 44, 38, 44 }, { 20, 45, 39, 45 }, { 20, 46, 40, 46 }, { 19, 47, 41, 47 },
+    { 18, 48, 42, 48 }, { 18, 49, 43, 49 }, { 17, 50, 44, 50 }, { 16, 51, 45, 51 }, { 0, 52, 46, 172 }, { 28, 35, 29, 35 },
+    { 27, 36, 30, 36 }, { 27, 37, 31, 37 }, { 26, 38, 32, 38 }, { 25, 39, 33, 39 }, { 24, 40, 34, 40 }, { 23, 41, 36, 41 },
+    { 22, 42, 37, 42 }, { 22, 43, 38, 43 }, { 21, 44, 39, 44 }, { 20, 45, 40, 45 }, { 20, 46, 41, 46 }, { 19, 47, 42, 47 },
+    { 18, 48, 43, 48 }, { 18, 49, 44, 49 }, { 17, 50, 45, 50 }, { 0, 51, 46, 172 }, { 29, 34, 29, 34 }, { 28, 35, 30, 35 },
+    { 27, 36, 32, 36 }, { 27, 37, 33, 37 }, { 26, 38, 34, 38 }, { 25, 39, 35, 39 }, { 24, 40, 36, 40 }, { 23, 41, 37, 41 },
+    { 22, 42, 38, 42 }, { 22, 43, 39, 43 }, { 21, 44, 40, 44 }, { 20, 45, 41, 45 }, { 20, 46, 42, 46 }, { 19, 47, 43, 47 },
+    { 18, 48, 44, 48 }, { 18, 49, 45, 49 }, { 17, 50, 46, 50 }, { 0, 51, 47, 172 }, { 30, 33, 30, 33 }, { 29, 34, 31, 34 },
+    { 28, 35, 32, 35 }, { 27, 36, 33, 36 }, { 27, 37, 34, 37 }, { 26, 38, 35, 38 }, { 25, 39, 36, 39 }, { 24, 40, 37, 40 },
+    { 23, 41, 38, 41 }, { 22, 42, 39, 42 }, { 22, 43, 40, 43 }, { 21, 44, 41, 44 }, { 20, 45, 42, 45 }, { 20, 46, 43, 46 },
+    { 19, 47, 44, 47 }, { 18, 48, 45, 48 }, { 18, 49, 46, 49 }, { 0, 50, 47, 172 }, { 30, 33, 31, 33 }, { 29, 34, 32, 34 },
+    { 28, 35, 33, 35 }, { 27, 36, 34, 36 }, { 27, 37, 35, 37 }, { 26, 38, 36, 38 }, { 25, 39, 37, 39 }, { 24, 40, 38, 40 },
+    { 23, 41, 39, 41 }, { 22, 42, 40, 42 }, { 22, 43, 41, 43 }, { 21, 44, 42, 44 }, { 20, 45, 43, 45 }, { 20, 46, 44, 46 },
+    { 19, 47, 45, 47 }, { 18, 48, 46, 48 }, { 18, 49, 47, 49 }, { 0, 50, 48, 172 }, { 31, 32, 31, 32 }, { 30, 33, 32, 33 },
+    { 29, 34, 33, 34 }, { 28, 35, 34, 35 }, { 27, 36, 35, 36 }, { 27, 37, 36, 37 }, { 26, 38, 37, 38 }, { 25, 39, 38, 39 },
+    { 24, 40, 39, 40 }, { 23, 41, 40, 41 }, { 22, 42, 41, 42 }, { 22, 43, 42, 43 }, { 21, 44, 43, 44 }, { 20, 45, 44, 45 },
+    { 20, 46, 45, 46 }, { 19, 47, 46, 47 }, { 18, 48, 47, 48 }, { 0, 49, 48, 172 }, { 32, 31, 32, 31 }, { 31, 32, 33, 32 },
+    { 30, 33, 34, 33 }, { 29, 34, 35, 34 }, { 28, 35, 36, 35 }, { 27, 36, 37, 36 }, { 27, 37, 38, 37 }, { 26, 38, 39, 38 },
+    { 25, 39, 40, 39 }, { 24, 40, 41, 40 }, { 23, 41, 42, 41 }, { 22, 42, 43, 42 }, { 22, 43, 44, 43 }, { 21, 44, 45, 44 },
+    { 20, 45, 46, 45 }, { 20, 46, 47, 46 }, { 19, 47, 48, 47 }, { 0, 48, 49, 172 }, { 32, 31, 33, 31 }, { 31, 32, 34, 32 },
+    { 30, 33, 35, 33 }, { 29, 34, 36, 34 }, { 28, 35, 37, 35 }, { 27, 36, 38, 36 }, { 27, 37, 39, 37 }, { 26, 38, 40, 38 },
+    { 25, 39, 41, 39 }, { 24, 40, 42, 40 }, { 23, 41, 43, 41 }, { 22, 42, 44, 42 }, { 22, 43, 45, 43 }, { 21, 44, 46, 44 },
+    { 20, 45, 47, 45 }, { 20, 46, 48, 46 }, { 19, 47, 49, 47 }, { 0, 48, 50, 172 }, { 33, 30, 34, 30 }, { 31, 31, 35, 32 },
+    { 30, 33, 36, 33 }, { 29, 34, 37, 34 }, { 28, 35, 38, 35 }, { 27, 36, 39, 36 }, { 27, 37, 40, 37 }, { 26, 38, 41, 38 },
+    { 25, 39, 42, 39 }, { 24, 40, 43, 40 }, { 23, 41, 44, 41 }, { 22, 42, 45, 42 }, { 22, 43, 46, 43 }, { 21, 44, 47, 44 },
+    { 20, 45, 48, 45 }, { 20, 46, 49, 46 }, { 0, 47, 50, 172 }, { 34, 29, 34, 29 }, { 33, 30, 35, 30 }, { 32, 31, 36, 31 },
+    { 31, 32, 37, 32 }, { 30, 33, 38, 33 }, { 29, 34, 39, 34 }, { 27, 35, 40, 36 }, { 27, 37, 41, 37 }, { 26, 38, 42, 38 },
+    { 25, 39, 43, 39 }, { 24, 40, 44, 40 }, { 23, 41, 45, 41 }, { 22, 42, 46, 42 }, { 22, 43, 47, 43 }, { 21, 44, 48, 44 },
+    { 20, 45, 49, 45 }, { 20, 46, 50, 46 }, { 0, 47, 51, 172 }, { 34, 29, 35, 29 }, { 33, 30, 36, 30 }, { 32, 31, 37, 31 },
+    { 31, 32, 38, 32 }, { 30, 33, 39, 33 }, { 29, 34, 40, 34 }, { 28, 35, 41, 35 }, { 27, 36, 42, 36 }, { 26, 37, 43, 38 },
+    { 25, 39, 44, 39 }, { 24, 40, 45, 40 }, { 23, 41, 46, 41 }, { 22, 42, 47, 42 }, { 22, 43, 48, 43 }, { 21, 44, 49, 44 },
+    { 20, 45, 50, 45 }, { 0, 46, 51, 172 }, { 35, 28, 36, 28 }, { 33, 29, 37, 30 }, { 32, 31, 38, 31 }, { 31, 32, 39, 32 },
+    { 30, 33, 40, 33 }, { 29, 34, 41, 34 }, { 28, 35, 42, 35 }, { 27, 36, 43, 36 }, { 27, 37, 44, 37 }, { 26, 38, 45, 38 },
+    { 24, 39, 46, 40 }, { 23, 41, 47, 41 }, { 22, 42, 48, 42 }, { 22, 43, 49, 43 }, { 21, 44, 50, 44 }, { 20, 45, 51, 45 },
+    { 0, 46, 52, 172 }, { 36, 27, 36, 27 }, { 35, 28, 37, 28 }, { 34, 29, 38, 29 }, { 33, 30, 39, 30 }, { 31, 31, 40, 32 },
+    { 30, 33, 41, 33 }, { 29, 34, 42, 34 }, { 28, 35, 43, 35 }, { 27, 36, 44, 36 }, { 27, 37, 45, 37 }, { 26, 38, 46, 38 },
+    { 25, 39, 47, 39 }, { 23, 40, 48, 41 }, { 22, 42, 49, 42 }, { 22, 43, 50, 43 }, { 21, 44, 51, 44 }, { 0, 45, 52, 172 },
+    { 36, 27, 37, 27 }, { 35, 28, 38, 28 }, { 34, 29, 39, 29 }, { 33, 30, 40, 30 }, { 32, 31, 41, 31 }, { 30, 32, 42, 33 },
+    { 29, 34, 43, 34 }, { 28, 35, 44, 35 }, { 27, 36, 45, 36 }, { 27, 37, 46, 37 }, { 26, 38, 47, 38 }, { 25, 39, 48, 39 },
+    { 23, 40, 49, 41 }, { 22, 42, 50, 42 }, { 22, 43, 51, 43 }, { 21, 44, 52, 44 }, { 0, 45, 53, 172 }, { 38, 26, 38, 26 },
+    { 35, 27, 39, 28 }, { 34, 29, 40, 29 }, { 33, 30, 41, 30 }, { 32, 31, 42, 31 }, { 31, 32, 43, 32 }, { 30, 33, 44, 33 },
+    { 28, 34, 45, 35 }, { 27, 36, 46, 36 }, { 27, 37, 47, 37 }, { 26, 38, 48, 38 }, { 25, 39, 49, 39 }, { 23, 40, 50, 41 },
+    { 22, 42, 51, 42 }, { 22, 43, 52, 43 }, { 0, 44, 53, 172 }, { 38, 26, 39, 26 }, { 36, 27, 40, 27 }, { 34, 28, 41, 29 },
+    { 33, 30, 42, 30 }, { 32, 31, 43, 31 }, { 31, 32, 44, 32 }, { 30, 33, 45, 33 }, { 28, 34, 46, 35 }, { 27, 36, 47, 36 },
+    { 27, 37, 48, 37 }, { 26, 38, 49, 38 }, { 25, 39, 50, 39 }, { 24, 40, 51, 40 }, { 22, 41, 52, 42 }, { 22, 43, 53, 43 },
+    { 0, 44, 54, 172 }, { 39, 25, 39, 25 }, { 38, 26, 40, 26 }, { 36, 27, 41, 27 }, { 35, 28, 42, 28 }, { 33, 29, 43, 30 },
+    { 32, 31, 44, 31 }, { 31, 32, 45, 32 }, { 30, 33, 46, 33 }, { 29, 34, 47, 34 }, { 27, 35, 48, 36 }, { 27, 37, 49, 37 },
+    { 26, 38, 50, 38 }, { 25, 39, 51, 39 }, { 24, 40, 52, 40 }, { 22, 41, 53, 42 }, { 0, 43, 54, 172 }, { 40, 24, 40, 24 },
+    { 38, 25, 41, 26 }, { 36, 27, 42, 27 }, { 35, 28, 43, 28 }, { 34, 29, 44, 29 }, { 32, 30, 45, 31 }, { 31, 32, 46, 32 },
+    { 30, 33, 47, 33 }, { 29, 34, 48, 34 }, { 27, 35, 49, 36 }, { 27, 37, 50, 37 }, { 26, 38, 51, 38 }, { 25, 39, 52, 39 },
+    { 24, 40, 53, 40 }, { 22, 41, 54, 42 }, { 0, 43, 55, 172 }, { 40, 24, 41, 24 }, { 39, 25, 42, 25 }, { 36, 26, 43, 27 },
+    { 35, 28, 44, 28 }, { 34, 29, 45, 29 }, { 33, 30, 46, 30 }, { 31, 31, 47, 32 }, { 30, 33, 48, 33 }, { 29, 34, 49, 34 },
+    { 28, 35, 50, 35 }, { 27, 36, 51, 37 }, { 26, 38, 52, 38 }, { 25, 39, 53, 39 }, { 24, 40, 54, 40 }, { 0, 41, 55, 172 },
+    { 41, 23, 41, 23 }, { 40, 24, 42, 24 }, { 39, 25, 43, 25 }, { 38, 26, 44, 26 }, { 35, 27, 45, 28 }, { 34, 29, 46, 29 },
+    { 33, 30, 47, 30 }, { 31, 31, 48, 32 }, { 30, 33, 49, 33 }, { 29, 34, 50, 34 }, { 28, 35, 51, 35 }, { 27, 36, 52, 37 },
+    { 26, 38, 53, 38 }, { 25, 39, 54, 39 }, { 23, 40, 55, 41 }, { 0, 42, 56, 172 }, { 42, 22, 42, 22 }, { 40, 23, 43, 24 },
+    { 39, 25, 44, 25 }, { 38, 26, 45, 26 }, { 35, 27, 46, 28 }, { 34, 29, 47, 29 }, { 33, 30, 48, 30 }, { 32, 31, 49, 31 },
+    { 30, 32, 50, 33 }, { 29, 34, 51, 34 }, { 28, 35, 52, 35 }, { 27, 36, 53, 37 }, { 26, 38, 54, 38 }, { 25, 39, 55, 39 },
+    { 23, 40, 56, 41 }, { 0, 42, 57, 172 }, { 42, 22, 43, 22 }, { 41, 23, 44, 23 }, { 39, 24, 45, 25 }, { 38, 26, 46, 26 },
+    { 36, 27, 47, 27 }, { 34, 28, 48, 29 }, { 33, 30, 49, 30 }, { 32, 31, 50, 31 }, { 30, 32, 51, 33 }, { 29, 34, 52, 34 },
+    { 28, 35, 53, 35 }, { 27, 36, 54, 37 }, { 26, 38, 55, 38 }, { 25, 39, 56, 39 }, { 0, 40, 57, 172 }, { 42, 21, 44, 22 },
+    { 41, 23, 45, 23 }, { 39, 24, 46, 25 }, { 38, 26, 47, 26 }, { 36, 27, 48, 27 }, { 34, 28, 49, 29 }, { 33, 30, 50, 30 },
+    { 32, 31, 51, 31 }, { 30, 32, 52, 33 }, { 29, 34, 53, 34 }, { 28, 35, 54, 35 }, { 27, 36, 55, 37 }, { 26, 38, 56, 38 },
+    { 25, 39, 57, 39 }, { 0, 40, 58, 172 }, { 42, 21, 45, 22 }, { 41, 23, 46, 23 }, { 40, 24, 47, 24 }, { 38, 25, 48, 26 },
+    { 36, 27, 49, 27 }, { 35, 28, 50, 28 }, { 33, 29, 51, 30 }, { 32, 31, 52, 31 }, { 30, 32, 53, 33 }, { 29, 34, 54, 34 },
+    { 28, 35, 55, 35 }, { 27, 36, 56, 37 }, { 26, 38, 57, 38 }, { 25, 39, 58, 39 }, { 0, 40, 59, 172 }, { 45, 20, 45, 20 },
+    { 44, 21, 46, 21 }, { 41, 22, 47, 23 }, { 40, 24, 48, 24 }, { 38, 25, 49, 26 }, { 36, 27, 50, 27 }, { 35, 28, 51, 28 },
+    { 33, 29, 52, 30 }, { 32, 31, 53, 31 }, { 30, 32, 54, 33 }, { 29, 34, 55, 34 }, { 28, 35, 56, 35 }, { 27, 36, 57, 37 },
+    { 26, 38, 58, 38 }, { 0, 39, 59, 172 }, { 45, 20, 46, 20 }, { 44, 21, 47, 21 }, { 41, 22, 48, 23 }, { 40, 24, 49, 24 },
+    { 39, 25, 50, 25 }, { 36, 26, 51, 27 }, { 35, 28, 52, 28 }, { 33, 29, 53, 30 }, { 32, 31, 54, 31 }, { 30, 32, 55, 33 },
+    { 29, 34, 56, 34 }, { 28, 35, 57, 35 }, { 27, 36, 58, 37 }, { 26, 38, 59, 38 }, { 0, 39, 60, 172 }, { 45, 19, 47, 20 },
+    { 44, 21, 48, 21 }, { 42, 22, 49, 22 }, { 40, 23, 50, 24 }, { 39, 25, 51, 25 }, { 36, 26, 52, 27 }, { 35, 28, 53, 28 },
+    { 33, 29, 54, 30 }, { 32, 31, 55, 31 }, { 30, 32, 56, 33 }, { 29, 34, 57, 34 }, { 27, 35, 58, 36 }, { 27, 37, 59, 37 },
+    { 26, 38, 60, 38 }, { 0, 39, 61, 172 }, { 47, 19, 48, 19 }, { 44, 20, 49, 21 }, { 42, 22, 50, 22 }, { 40, 23, 51, 24 },
+    { 39, 25, 52, 25 }, { 36, 26, 53, 27 }, { 35, 28, 54, 28 }, { 33, 29, 55, 30 }, { 32, 31, 56, 31 }, { 30, 32, 57, 33 },
+    { 29, 34, 58, 34 }, { 27, 35, 59, 36 }, { 27, 37, 60, 37 }, { 0, 38, 61, 172 }, { 48, 18, 48, 18 }, { 47, 19, 49, 19 },
+    { 44, 20, 50, 21 }, { 42, 22, 51, 22 }, { 40, 23, 52, 24 }, { 39, 25, 53, 25 }, { 36, 26, 54, 27 }, { 35, 28, 55, 28 },
+    { 33, 29, 56, 30 }, { 32, 31, 57, 31 }, { 30, 32, 58, 33 }, { 29, 34, 59, 34 }, { 27, 35, 60, 36 }, { 27, 37, 61, 37 },
+    { 0, 38, 62, 172 }, { 47, 18, 50, 19 }, { 45, 20, 51, 20 }, { 42, 21, 52, 22 }, { 40, 23, 53, 24 }, { 39, 25, 54, 25 },
+    { 36, 26, 55, 27 }, { 35, 28, 56, 28 }, { 33, 29, 57, 30 }, { 32, 31, 58, 31 }, { 30, 32, 59, 33 }, { 29, 34, 60, 34 },
+    { 27, 35, 61, 36 }, { 0, 37, 62, 172 }, { 50, 17, 50, 17 }, { 47, 18, 51, 19 }, { 45, 20, 52, 20 }, { 42, 21, 53, 22 },
+    { 41, 23, 54, 23 }, { 39, 24, 55, 25 }, { 36, 26, 56, 27 }, { 35, 28, 57, 28 }, { 33, 29, 58, 30 }, { 32, 31, 59, 31 },
+    { 30, 32, 60, 33 }, { 29, 34, 61, 34 }, { 27, 35, 62, 36 }, { 0, 37, 63, 172 }, { 50, 16, 51, 17 }, { 47, 18, 52, 19 },
+    { 45, 20, 53, 20 }, { 42, 21, 54, 22 }, { 41, 23, 55, 23 }, { 39, 24, 56, 25 }, { 36, 26, 57, 27 }, { 35, 28, 58, 28 },
+    { 33, 29, 59, 30 }, { 32, 31, 60, 31 }, { 30, 32, 61, 33 }, { 28, 34, 62, 35 }, { 27, 36, 63, 36 }, { 0, 37, 64, 172 },
+    { 50, 16, 52, 17 }, { 48, 18, 53, 18 }, { 45, 19, 54, 20 }, { 42, 21, 55, 22 }, { 41, 23, 56, 23 }, { 39, 24, 57, 25 },
+    { 36, 26, 58, 27 }, { 35, 28, 59, 28 }, { 33, 29, 60, 30 }, { 32, 31, 61, 31 }, { 30, 32, 62, 33 }, { 28, 34, 63, 35 },
+    { 0, 36, 64, 172 }, { 50, 16, 53, 17 }, { 48, 18, 54, 18 }, { 45, 19, 55, 20 }, { 42, 21, 56, 22 }, { 41, 23, 57, 23 },
+    { 39, 24, 58, 25 }, { 36, 26, 59, 27 }, { 35, 28, 60, 28 }, { 33, 29, 61, 30 }, { 31, 31, 62, 32 }, { 30, 33, 63, 33 },
+    { 28, 34, 64, 35 }, { 0, 36, 65, 172 }, { 53, 15, 53, 15 }, { 51, 16, 54, 16 }, { 48, 17, 55, 18 }, { 45, 19, 56, 20 },
+    { 42, 21, 57, 22 }, { 41, 23, 58, 23 }, { 39, 24, 59, 25 }, { 36, 26, 60, 27 }, { 35, 28, 61, 28 }, { 33, 29, 62, 30 },
+    { 31, 31, 63, 32 }, { 30, 33, 64, 33 }, { 0, 34, 65, 172 }, { 53, 14, 54, 15 }, { 51, 16, 55, 16 }, { 48, 17, 56, 18 },
+    { 45, 19, 57, 20 }, { 42, 21, 58, 22 }, { 41, 23, 59, 23 }, { 39, 24, 60, 25 }, { 36, 26, 61, 27 }, { 35, 28, 62, 28 },
+    { 33, 29, 63, 30 }, { 31, 31, 64, 32 }, { 29, 33, 65, 34 }, { 0, 35, 66, 172 }, { 54, 14, 55, 14 }, { 51, 15, 56, 16 },
+    { 48, 17, 57, 18 }, { 45, 19, 58, 20 }, { 42, 21, 59, 22 }, { 41, 23, 60, 23 }, { 39, 24, 61, 25 }, { 36, 26, 62, 27 },
+    { 34, 28, 63, 29 }, { 33, 30, 64, 30 }, { 31, 31, 65, 32 }, { 29, 33, 66, 34 }, { 0, 35, 67, 172 }, { 54, 13, 56, 14 },
+    { 51, 15, 57, 16 }, { 48, 17, 58, 18 }, { 45, 19, 59, 20 }, { 42, 21, 60, 22 }, { 41, 23, 61, 23 }, { 39, 24, 62, 25 },
+    { 36, 26, 63, 27 }, { 34, 28, 64, 29 }, { 32, 30, 65, 31 }, { 31, 32, 66, 32 }, { 0, 33, 67, 172 }, { 54, 13, 57, 14 },
+    { 51, 15, 58, 16 }, { 48, 17, 59, 18 }, { 45, 19, 60, 20 }, { 42, 21, 61, 22 }, { 41, 23, 62, 23 }, { 39, 24, 63, 25 },
+    { 36, 26, 64, 27 }, { 34, 28, 65, 29 }, { 32, 30, 66, 31 }, { 30, 32, 67, 33 }, { 0, 34, 68, 172 }, { 54, 13, 58, 14 },
+    { 51, 15, 59, 16 }, { 48, 17, 60, 18 }, { 45, 19, 61, 20 }, { 42, 21, 62, 22 }, { 41, 23, 63, 23 }, { 39, 24, 64, 25 },
+    { 36, 26, 65, 27 }, { 34, 28, 66, 29 }, { 32, 30, 67, 31 }, { 30, 32, 68, 33 }, { 0, 34, 69, 172 }, { 58, 12, 58, 12 },
+    { 54, 13, 59, 14 }, { 51, 15, 60, 16 }, { 48, 17, 61, 18 }, { 45, 19, 62, 20 }, { 42, 21, 63, 22 }, { 40, 23, 64, 24 },
+    { 39, 25, 65, 25 }, { 36, 26, 66, 27 }, { 34, 28, 67, 29 }, { 32, 30, 68, 31 }, { 0, 32, 69, 172 }, { 58, 12, 59, 12 },
+    { 54, 13, 60, 14 }, { 51, 15, 61, 16 }, { 48, 17, 62, 18 }, { 45, 19, 63, 20 }, { 42, 21, 64, 22 }, { 40, 23, 65, 24 },
+    { 38, 25, 66, 26 }, { 35, 27, 67, 28 }, { 33, 29, 68, 30 }, { 32, 31, 69, 31 }, { 0, 32, 70, 172 }, { 58, 11, 60, 12 },
+    { 54, 13, 61, 14 }, { 51, 15, 62, 16 }, { 48, 17, 63, 18 }, { 45, 19, 64, 20 }, { 42, 21, 65, 22 }, { 40, 23, 66, 24 },
+    { 38, 25, 67, 26 }, { 35, 27, 68, 28 }, { 33, 29, 69, 30 }, { 31, 31, 70, 32 }, { 0, 33, 71, 172 }, { 58, 11, 61, 12 },
+    { 54, 13, 62, 14 }, { 51, 15, 63, 16 }, { 48, 17, 64, 18 }, { 45, 19, 65, 20 }, { 42, 21, 66, 22 }, { 40, 23, 67, 24 },
+    { 38, 25, 68, 26 }, { 35, 27, 69, 28 }, { 33, 29, 70, 30 }, { 0, 31, 71, 172 }, { 58, 10, 62, 12 }, { 54, 13, 63, 14 },
+    { 51, 15, 64, 16 }, { 48, 17, 65, 18 }, { 45, 19, 66, 20 }, { 42, 21, 67, 22 }, { 40, 23, 68, 24 }, { 38, 25, 69, 26 },
+    { 35, 27, 70, 28 }, { 33, 29, 71, 30 }, { 0, 31, 72, 172 }, { 60, 10, 63, 11 }, { 54, 12, 64, 14 }, { 51, 15, 65, 16 },
+    { 48, 17, 66, 18 }, { 45, 19, 67, 20 }, { 42, 21, 68, 22 }, { 40, 23, 69, 24 }, { 38, 25, 70, 26 }, { 34, 27, 71, 29 },
+    { 32, 30, 72, 31 }, { 0, 32, 73, 172 }, { 60, 10, 64, 11 }, { 54, 12, 65, 14 }, { 51, 15, 66, 16 }, { 48, 17, 67, 18 },
+    { 45, 19, 68, 20 }, { 42, 21, 69, 22 }, { 39, 23, 70, 25 }, { 36, 26, 71, 27 }, { 34, 28, 72, 29 }, { 0, 30, 73, 172 },
+    { 64, 9, 64, 9 }, { 60, 10, 65, 11 }, { 54, 12, 66, 14 }, { 51, 15, 67, 16 }, { 48, 17, 68, 18 }, { 45, 19, 69, 20 },
+    { 41, 21, 70, 23 }, { 39, 24, 71, 25 }, { 36, 26, 72, 27 }, { 34, 28, 73, 29 }, { 0, 30, 74, 172 }, { 64, 9, 65, 9 },
+    { 60, 10, 66, 11 }, { 54, 12, 67, 14 }, { 51, 15, 68, 16 }, { 48, 17, 69, 18 }, { 45, 19, 70, 20 }, { 41, 21, 71, 23 },
+    { 39, 24, 72, 25 }, { 36, 26, 73, 27 }, { 33, 28, 74, 30 }, { 0, 31, 75, 172 }, { 64, 8, 66, 9 }, { 60, 10, 67, 11 },
+    { 54, 12, 68, 14 }, { 51, 15, 69, 16 }, { 48, 17, 70, 18 }, { 44, 19, 71, 21 }, { 41, 22, 72, 23 }, { 39, 24, 73, 25 },
+    { 35, 26, 74, 28 }, { 0, 29, 75, 172 }, { 64, 8, 67, 9 }, { 60, 10, 68, 11 }, { 54, 12, 69, 14 }, { 51, 15, 70, 16 },
+    { 48, 17, 71, 18 }, { 44, 19, 72, 21 }, { 41, 22, 73, 23 }, { 38, 24, 74, 26 }, { 35, 27, 75, 28 }, { 0, 29, 76, 172 },
+    { 64, 8, 68, 9 }, { 60, 10, 69, 11 }, { 54, 12, 70, 14 }, { 51, 15, 71, 16 }, { 47, 17, 72, 19 }, { 44, 20, 73, 21 },
+    { 40, 22, 74, 24 }, { 38, 25, 75, 26 }, { 34, 27, 76, 29 }, { 0, 30, 77, 172 }, { 64, 7, 69, 9 }, { 60, 10, 70, 11 },
+    { 54, 12, 71, 14 }, { 51, 15, 72, 16 }, { 47, 17, 73, 19 }, { 44, 20, 74, 21 }, { 40, 22, 75, 24 }, { 38, 25, 76, 26 },
+    { 34, 27, 77, 29 }, { 0, 30, 78, 172 }, { 64, 7, 70, 9 }, { 60, 10, 71, 11 }, { 54, 12, 72, 14 }, { 50, 15, 73, 17 },
+    { 47, 18, 74, 19 }, { 42, 20, 75, 22 }, { 40, 23, 76, 24 }, { 36, 25, 77, 27 }, { 0, 28, 78, 172 }, { 64, 7, 71, 9 },
+    { 60, 10, 72, 11 }, { 54, 12, 73, 14 }, { 50, 15, 74, 17 }, { 47, 18, 75, 19 }, { 42, 20, 76, 22 }, { 39, 23, 77, 25 },
+    { 36, 26, 78, 27 }, { 0, 28, 79, 172 }, { 71, 6, 71, 6 }, { 64, 7, 72, 9 }, { 60, 10, 73, 11 }, { 54, 12, 74, 14 },
+    { 50, 15, 75, 17 }, { 45, 18, 76, 20 }, { 42, 21, 77, 22 }, { 39, 23, 78, 25 }, { 35, 26, 79, 28 }, { 0, 29, 80, 172 },
+    { 71, 6, 72, 6 }, { 64, 7, 73, 9 }, { 58, 10, 74, 12 }, { 54, 13, 75, 14 }, { 50, 15, 76, 17 }, { 45, 18, 77, 20 },
+    { 41, 21, 78, 23 }, { 38, 24, 79, 26 }, { 0, 27, 80, 172 }, { 71, 6, 73, 6 }, { 64, 7, 74, 9 }, { 58, 10, 75, 12 },
+    { 53, 13, 76, 15 }, { 48, 16, 77, 18 }, { 45, 19, 78, 20 }, { 41, 21, 79, 23 }, { 38, 24, 80, 26 }, { 0, 27, 81, 172 },
+    { 71, 5, 74, 6 }, { 64, 7, 75, 9 }, { 58, 10, 76, 12 }, { 53, 13, 77, 15 }, { 48, 16, 78, 18 }, { 44, 19, 79, 21 },
+    { 40, 22, 80, 24 }, { 36, 25, 81, 27 }, { 0, 28, 82, 172 }, { 71, 5, 75, 6 }, { 64, 7, 76, 9 }, { 58, 10, 77, 12 },
+    { 53, 13, 78, 15 }, { 48, 16, 79, 18 }, { 44, 19, 80, 21 }, { 40, 22, 81, 24 }, { 36, 25, 82, 27 }, { 0, 28, 83, 172 },
+    { 71, 5, 76, 6 }, { 64, 7, 77, 9 }, { 58, 10, 78, 12 }, { 53, 13, 79, 15 }, { 47, 16, 80, 19 }, { 42, 20, 81, 22 },
+    { 39, 23, 82, 25 }, { 0, 26, 83, 172 }, { 71, 4, 77, 6 }, { 64, 7, 78, 9 }, { 56, 10, 79, 13 }, { 51, 14, 80, 16 },
+    { 47, 17, 81, 19 }, { 42, 20, 82, 22 }, { 38, 23, 83, 26 }, { 0, 27, 84, 172 }, { 71, 4, 78, 6 }, { 64, 7, 79, 9 },
+    { 56, 10, 80, 13 }, { 51, 14, 81, 16 }, { 45, 17, 82, 20 }, { 41, 21, 83, 23 }, { 38, 24, 84, 26 }, { 0, 27, 85, 172 },
+    { 71, 4, 79, 6 }, { 62, 7, 80, 10 }, { 56, 11, 81, 13 }, { 50, 14, 82, 17 }, { 45, 18, 83, 20 }, { 40, 21, 84, 24 },
+    { 0, 25, 85, 172 }, { 71, 4, 80, 6 }, { 62, 7, 81, 10 }, { 56, 11, 82, 13 }, { 50, 14, 83, 17 }, { 44, 18, 84, 21 },
+    { 40, 22, 85, 24 }, { 0, 25, 86, 172 }, { 71, 4, 81, 6 }, { 62, 7, 82, 10 }, { 54, 11, 83, 14 }, { 48, 15, 84, 18 },
+    { 44, 19, 85, 21 }, { 39, 22, 86, 25 }, { 0, 26, 87, 172 }, { 81, 3, 81, 3 }, { 69, 4, 82, 7 }, { 62, 8, 83, 10 },
+    { 54, 11, 84, 14 }, { 48, 15, 85, 18 }, { 42, 19, 86, 22 }, { 0, 23, 87, 172 }, { 81, 3, 82, 3 }, { 69, 4, 83, 7 },
+    { 60, 8, 84, 11 }, { 53, 12, 85, 15 }, { 47, 16, 86, 19 }, { 41, 20, 87, 23 }, { 0, 24, 88, 172 }, { 81, 3, 83, 3 },
+    { 69, 4, 84, 7 }, { 60, 8, 85, 11 }, { 53, 12, 86, 15 }, { 47, 16, 87, 19 }, { 40, 20, 88, 24 }, { 0, 25, 89, 172 },
+    { 81, 3, 84, 3 }, { 69, 4, 85, 7 }, { 58, 8, 86, 12 }, { 51, 13, 87, 16 }, { 45, 17, 88, 20 }, { 39, 21, 89, 25 },
+    { 0, 26, 90, 172 }, { 81, 2, 85, 3 }, { 66, 4, 86, 8 }, { 58, 9, 87, 12 }, { 50, 13, 88, 17 }, { 44, 18, 89, 21 },
+    { 0, 22, 90, 172 }, { 81, 2, 86, 3 }, { 66, 4, 87, 8 }, { 56, 9, 88, 13 }, { 50, 14, 89, 17 }, { 42, 18, 90, 22 },
+    { 0, 23, 91, 172 }, { 81, 2, 87, 3 }, { 66, 4, 88, 8 }, { 56, 9, 89, 13 }, { 48, 14, 90, 18 }, { 41, 19, 91, 23 },
+    { 0, 24, 92, 172 }, { 77, 2, 88, 4 }, { 64, 5, 89, 9 }, { 54, 10, 90, 14 }, { 47, 15, 91, 19 }, { 40, 20, 92, 24 },
+    { 0, 25, 93, 172 }, { 77, 1, 89, 4 }, { 64, 5, 90, 9 }, { 53, 10, 91, 15 }, { 45, 16, 92, 20 }, { 0, 21, 93, 172 },
+    { 77, 1, 90, 4 }, { 62, 5, 91, 10 }, { 53, 11, 92, 15 }, { 44, 16, 93, 21 }, { 0, 22, 94, 172 }, { 77, 1, 91, 4 },
+    { 62, 5, 92, 10 }, { 51, 11, 93, 16 }, { 42, 17, 94, 22 }, { 0, 23, 95, 172 }, { 74, 1, 92, 5 }, { 60, 6, 93, 11 },
+    { 50, 12, 94, 17 }, { 40, 18, 95, 24 }, { 0, 25, 96, 172 }, { 74, 1, 93, 5 }, { 58, 6, 94, 12 }, { 47, 13, 95, 19 },
+    { 0, 20, 96, 172 }, { 71, 1, 94, 6 }, { 56, 7, 95, 13 }, { 45, 14, 96, 20 }, { 0, 21, 97, 172 }, { 71, 1, 95, 6 },
+    { 54, 7, 96, 14 }, { 42, 15, 97, 22 }, { 0, 23, 98, 172 }, { 69, 0, 96, 7 }, { 53, 8, 97, 15 }, { 41, 16, 98, 23 },
+    { 0, 24, 99, 172 }, { 66, 0, 97, 8 }, { 50, 9, 98, 17 }, { 0, 18, 99, 172 }, { 96, 0, 97, 0 }, { 64, 1, 98, 9 },
+    { 47, 10, 99, 19 }, { 0, 20, 100, 172 }, { 96, 0, 98, 0 }, { 62, 1, 99, 10 }, { 44, 11, 100, 21 }, { 0, 22, 101, 172 },
+    { 96, 0, 99, 0 }, { 58, 1, 100, 12 }, { 41, 13, 101, 23 }, { 0, 24, 102, 172 }, { 89, 0, 100, 1 }, { 54, 2, 101, 14 },
+    { 0, 15, 102, 172 }, { 85, 0, 101, 2 }, { 51, 3, 102, 16 }, { 0, 17, 103, 172 }, { 81, 0, 102, 3 }, { 47, 4, 103, 19 },
+    { 0, 20, 104, 172 }, { 77, 0, 103, 4 }, { 41, 5, 104, 23 }, { 0, 24, 105, 172 }, { 71, 0, 104, 6 }, { 0, 7, 105, 172 },
+    { 64, 0, 105, 9 }, { 0, 10, 106, 172 }, { 54, 0, 106, 14 }, { 0, 15, 107, 172 }, { 0, 0, 107, 172 }, { 0, 0, 108, 172 },
+    { 0, 0, 109, 172 }, { 0, 0, 110, 172 }, { 0, 0, 111, 172 }, { 54, 0, 112, 14 }, { 0, 15, 111, 172 }, { 64, 0, 113, 9 },
+    { 0, 10, 112, 172 }, { 71, 0, 114, 6 }, { 0, 7, 113, 172 }, { 77, 0, 115, 4 }, { 41, 5, 114, 23 }, { 0, 24, 105, 172 },
+    { 81, 0, 116, 3 }, { 47, 4, 115, 19 }, { 0, 20, 114, 172 }, { 85, 0, 117, 2 }, { 51, 3, 116, 16 }, { 0, 17, 115, 172 },
+    { 89, 0, 118, 1 }, { 54, 2, 117, 14 }, { 0, 15, 116, 172 }, { 96, 0, 119, 0 }, { 58, 1, 118, 12 }, { 41, 13, 117, 23 },
+    { 0, 24, 116, 172 }, { 96, 0, 120, 0 }, { 62, 1, 119, 10 }, { 44, 11, 118, 21 }, { 0, 22, 117, 172 }, { 96, 0, 121, 0 },
+    { 64, 1, 120, 9 }, { 47, 10, 119, 19 }, { 0, 20, 118, 172 }, { 66, 0, 121, 8 }, { 50, 9, 120, 17 }, { 0, 18, 119, 172 },
+    { 69, 0, 122, 7 }, { 53, 8, 121, 15 }, { 41, 16, 120, 23 }, { 0, 24, 119, 172 }, { 71, 0, 123, 6 }, { 54, 7, 122, 14 },
+    { 42, 15, 121, 22 }, { 0, 23, 120, 172 }, { 71, 0, 124, 6 }, { 56, 7, 123, 13 }, { 45, 14, 122, 20 }, { 0, 21, 121, 172 },
+    { 74, 0, 125, 5 }, { 58, 6, 124, 12 }, { 47, 13, 123, 19 }, { 0, 20, 122, 172 }, { 74, 0, 126, 5 }, { 60, 6, 125, 11 },
+    { 50, 12, 124, 17 }, { 40, 18, 123, 24 }, { 0, 25, 96, 172 }, { 77, 0, 127, 4 }, { 62, 5, 126, 10 }, { 51, 11, 125, 16 },
+    { 42, 17, 124, 22 }, { 0, 23, 123, 172 }, { 77, 0, 128, 4 }, { 62, 5, 127, 10 }, { 53, 11, 126, 15 }, { 44, 16, 125, 21 },
+    { 0, 22, 124, 172 }, { 77, 0, 129, 4 }, { 64, 5, 128, 9 }, { 53, 10, 127, 15 }, { 45, 16, 126, 20 }, { 0, 21, 125, 172 },
+    { 77, 0, 130, 4 }, { 64, 5, 129, 9 }, { 54, 10, 128, 14 }, { 47, 15, 127, 19 }, { 40, 20, 126, 24 }, { 0, 25, 125, 172 },
+    { 81, 0, 131, 3 }, { 66, 4, 130, 8 }, { 56, 9, 129, 13 }, { 48, 14, 128, 18 }, { 41, 19, 127, 23 }, { 0, 24, 126, 172 },
+    { 81, 0, 132, 3 }, { 66, 4, 131, 8 }, { 56, 9, 130, 13 }, { 50, 14, 129, 17 }, { 42, 18, 128, 22 }, { 0, 23, 127, 172 },
+    { 81, 0, 133, 3 }, { 66, 4, 132, 8 }, { 58, 9, 131, 12 }, { 50, 13, 130, 17 }, { 44, 18, 129, 21 }, { 0, 22, 128, 172 },
+    { 81, 0, 134, 3 }, { 69, 4, 133, 7 }, { 58, 8, 132, 12 }, { 51, 13, 131, 16 }, { 45, 17, 130, 20 }, { 39, 21, 129, 25 },
+    { 0, 26, 90, 172 }, { 81, 0, 135, 3 }, { 69, 4, 134, 7 }, { 60, 8, 133, 11 }, { 53, 12, 132, 15 }, { 47, 16, 131, 19 },
+    { 40, 20, 130, 24 }, { 0, 25, 129, 172 }, { 81, 0, 136, 3 }, { 69, 4, 135, 7 }, { 60, 8, 134, 11 }, { 53, 12, 133, 15 },
+    { 47, 16, 132, 19 }, { 41, 20, 131, 23 }, { 0, 24, 130, 172 }, { 81, 0, 137, 3 }, { 69, 4, 136, 7 }, { 62, 8, 135, 10 },
+    { 54, 11, 134, 14 }, { 48, 15, 133, 18 }, { 42, 19, 132, 22 }, { 0, 23, 131, 172 }, { 81, 0, 138, 3 }, { 71, 4, 137, 6 },
+    { 62, 7, 136, 10 }, { 54, 11, 135, 14 }, { 48, 15, 134, 18 }, { 44, 19, 133, 21 }, { 39, 22, 132, 25 }, { 0, 26, 131, 172 },
+    { 71, 0, 138, 6 }, { 62, 7, 137, 10 }, { 56, 11, 136, 13 }, { 50, 14, 135, 17 }, { 44, 18, 134, 21 }, { 40, 22, 133, 24 },
+    { 0, 25, 132, 172 }, { 71, 0, 139, 6 }, { 62, 7, 138, 10 }, { 56, 11, 137, 13 }, { 50, 14, 136, 17 }, { 45, 18, 135, 20 },
+    { 40, 21, 134, 24 }, { 0, 25, 133, 172 }, { 71, 0, 140, 6 }, { 64, 7, 139, 9 }, { 56, 10, 138, 13 }, { 51, 14, 137, 16 },
+    { 45, 17, 136, 20 }, { 41, 21, 135, 23 }, { 38, 24, 134, 26 }, { 0, 27, 133, 172 }, { 71, 0, 141, 6 }, { 64, 7, 140, 9 },
+    { 56, 10, 139, 13 }, { 51, 14, 138, 16 }, { 47, 17, 137, 19 }, { 42, 20, 136, 22 }, { 38, 23, 135, 26 }, { 0, 27, 134, 172 },
+    { 71, 0, 142, 6 }, { 64, 7, 141, 9 }, { 58, 10, 140, 12 }, { 53, 13, 139, 15 }, { 47, 16, 138, 19 }, { 42, 20, 137, 22 },
+    { 39, 23, 136, 25 }, { 0, 26, 135, 172 }, { 71, 0, 143, 6 }, { 64, 7, 142, 9 }, { 58, 10, 141, 12 }, { 53, 13, 140, 15 },
+    { 48, 16, 139, 18 }, { 44, 19, 138, 21 }, { 40, 22, 137, 24 }, { 36, 25, 136, 27 }, { 0, 28, 83, 172 }, { 71, 0, 144, 6 },
+    { 64, 7, 143, 9 }, { 58, 10, 142, 12 }, { 53, 13, 141, 15 }, { 48, 16, 140, 18 }, { 44, 19, 139, 21 }, { 40, 22, 138, 24 },
+    { 36, 25, 137, 27 }, { 0, 28, 136, 172 }, { 71, 0, 145, 6 }, { 64, 7, 144, 9 }, { 58, 10, 143, 12 }, { 53, 13, 142, 15 },
+    { 48, 16, 141, 18 }, { 45, 19, 140, 20 }, { 41, 21, 139, 23 }, { 38, 24, 138, 26 }, { 0, 27, 137, 172 }, { 71, 0, 146, 6 },
+    { 64, 7, 145, 9 }, { 58, 10, 144, 12 }, { 54, 13, 143, 14 }, { 50, 15, 142, 17 }, { 45, 18, 141, 20 }, { 41, 21, 140, 23 },
+    { 38, 24, 139, 26 }, { 0, 27, 138, 172 }, { 71, 0, 147, 6 }, { 64, 7, 146, 9 }, { 60, 10, 145, 11 }, { 54, 12, 144, 14 },
+    { 50, 15, 143, 17 }, { 45, 18, 142, 20 }, { 42, 21, 141, 22 }, { 39, 23, 140, 25 }, { 35, 26, 139, 28 }, { 0, 29, 80, 172 },
+    { 71, 0, 148, 6 }, { 64, 7, 147, 9 }, { 60, 10, 146, 11 }, { 54, 12, 145, 14 }, { 50, 15, 144, 17 }, { 47, 18, 143, 19 },
+    { 42, 20, 142, 22 }, { 39, 23, 141, 25 }, { 36, 26, 140, 27 }, { 0, 28, 139, 172 }, { 64, 0, 148, 9 }, { 60, 10, 147, 11 },
+    { 54, 12, 146, 14 }, { 50, 15, 145, 17 }, { 47, 18, 144, 19 }, { 42, 20, 143, 22 }, { 40, 23, 142, 24 }, { 36, 25, 141, 27 },
+    { 0, 28, 140, 172 }, { 64, 0, 149, 9 }, { 60, 10, 148, 11 }, { 54, 12, 147, 14 }, { 51, 15, 146, 16 }, { 47, 17, 145, 19 },
+    { 44, 20, 144, 21 }, { 40, 22, 143, 24 }, { 38, 25, 142, 26 }, { 34, 27, 141, 29 }, { 0, 30, 78, 172 }, { 64, 0, 150, 9 },
+    { 60, 10, 149, 11 }, { 54, 12, 148, 14 }, { 51, 15, 147, 16 }, { 47, 17, 146, 19 }, { 44, 20, 145, 21 }, { 40, 22, 144, 24 },
+    { 38, 25, 143, 26 }, { 34, 27, 142, 29 }, { 0, 30, 141, 172 }, { 64, 0, 151, 9 }, { 60, 10, 150, 11 }, { 54, 12, 149, 14 },
+    { 51, 15, 148, 16 }, { 48, 17, 147, 18 }, { 44, 19, 146, 21 }, { 41, 22, 145, 23 }, { 38, 24, 144, 26 }, { 35, 27, 143, 28 },
+    { 0, 29, 142, 172 }, { 64, 0, 152, 9 }, { 60, 10, 151, 11 }, { 54, 12, 150, 14 }, { 51, 15, 149, 16 }, { 48, 17, 148, 18 },
+    { 44, 19, 147, 21 }, { 41, 22, 146, 23 }, { 39, 24, 145, 25 }, { 35, 26, 144, 28 }, { 0, 29, 143, 172 }, { 64, 0, 153, 9 },
+    { 60, 10, 152, 11 }, { 54, 12, 151, 14 }, { 51, 15, 150, 16 }, { 48, 17, 149, 18 }, { 45, 19, 148, 20 }, { 41, 21, 147, 23 },
+    { 39, 24, 146, 25 }, { 36, 26, 145, 27 }, { 33, 28, 144, 30 }, { 0, 31, 75, 172 }, { 64, 0, 154, 9 }, { 60, 10, 153, 11 },
+    { 54, 12, 152, 14 }, { 51, 15, 151, 16 }, { 48, 17, 150, 18 }, { 45, 19, 149, 20 }, { 41, 21, 148, 23 }, { 39, 24, 147, 25 },
+    { 36, 26, 146, 27 }, { 34, 28, 145, 29 }, { 0, 30, 144, 172 }, { 64, 0, 155, 9 }, { 60, 10, 154, 11 }, { 54, 12, 153, 14 },
+    { 51, 15, 152, 16 }, { 48, 17, 151, 18 }, { 45, 19, 150, 20 }, { 42, 21, 149, 22 }, { 39, 23, 148, 25 }, { 36, 26, 147, 27 },
+    { 34, 28, 146, 29 }, { 0, 30, 145, 172 }, { 60, 0, 155, 11 }, { 54, 12, 154, 14 }, { 51, 15, 153, 16 }, { 48, 17, 152, 18 },
+    { 45, 19, 151, 20 }, { 42, 21, 150, 22 }, { 40, 23, 149, 24 }, { 38, 25, 148, 26 }, { 34, 27, 147, 29 }, { 32, 30, 146, 31 },
+    { 0, 32, 73, 172 }, { 58, 0, 156, 12 }, { 54, 13, 155, 14 }, { 51, 15, 154, 16 }, { 48, 17, 153, 18 }, { 45, 19, 152, 20 },
+    { 42, 21, 151, 22 }, { 40, 23, 150, 24 }, { 38, 25, 149, 26 }, { 35, 27, 148, 28 }, { 33, 29, 147, 30 }, { 0, 31, 146, 172 },
+    { 58, 0, 157, 12 }, { 54, 13, 156, 14 }, { 51, 15, 155, 16 }, { 48, 17, 154, 18 }, { 45, 19, 153, 20 }, { 42, 21, 152, 22 },
+    { 40, 23, 151, 24 }, { 38, 25, 150, 26 }, { 35, 27, 149, 28 }, { 33, 29, 148, 30 }, { 0, 31, 147, 172 }, { 58, 0, 158, 12 },
+    { 54, 13, 157, 14 }, { 51, 15, 156, 16 }, { 48, 17, 155, 18 }, { 45, 19, 154, 20 }, { 42, 21, 153, 22 }, { 40, 23, 152, 24 },
+    { 38, 25, 151, 26 }, { 35, 27, 150, 28 }, { 33, 29, 149, 30 }, { 31, 31, 148, 32 }, { 0, 33, 71, 172 }, { 58, 0, 159, 12 },
+    { 54, 13, 158, 14 }, { 51, 15, 157, 16 }, { 48, 17, 156, 18 }, { 45, 19, 155, 20 }, { 42, 21, 154, 22 }, { 40, 23, 153, 24 },
+    { 38, 25, 152, 26 }, { 35, 27, 151, 28 }, { 33, 29, 150, 30 }, { 32, 31, 149, 31 }, { 0, 32, 148, 172 }, { 58, 0, 160, 12 },
+    { 54, 13, 159, 14 }, { 51, 15, 158, 16 }, { 48, 17, 157, 18 }, { 45, 19, 156, 20 }, { 42, 21, 155, 22 }, { 40, 23, 154, 24 },
+    { 39, 25, 153, 25 }, { 36, 26, 152, 27 }, { 34, 28, 151, 29 }, { 32, 30, 150, 31 }, { 0, 32, 149, 172 }, { 58, 0, 161, 12 },
+    { 54, 13, 160, 14 }, { 51, 15, 159, 16 }, { 48, 17, 158, 18 }, { 45, 19, 157, 20 }, { 42, 21, 156, 22 }, { 41, 23, 155, 23 },
+    { 39, 24, 154, 25 }, { 36, 26, 153, 27 }, { 34, 28, 152, 29 }, { 32, 30, 151, 31 }, { 30, 32, 150, 33 }, { 0, 34, 69, 172 },
+    { 54, 0, 161, 14 }, { 51, 15, 160, 16 }, { 48, 17, 159, 18 }, { 45, 19, 158, 20 }, { 42, 21, 157, 22 }, { 41, 23, 156, 23 },
+    { 39, 24, 155, 25 }, { 36, 26, 154, 27 }, { 34, 28, 153, 29 }, { 32, 30, 152, 31 }, { 30, 32, 151, 33 }, { 0, 34, 150, 172 },
+    { 54, 0, 162, 14 }, { 51, 15, 161, 16 }, { 48, 17, 160, 18 }, { 45, 19, 159, 20 }, { 42, 21, 158, 22 }, { 41, 23, 157, 23 },
+    { 39, 24, 156, 25 }, { 36, 26, 155, 27 }, { 34, 28, 154, 29 }, { 32, 30, 153, 31 }, { 31, 32, 152, 32 }, { 0, 33, 151, 172 },
+    { 54, 0, 163, 14 }, { 51, 15, 162, 16 }, { 48, 17, 161, 18 }, { 45, 19, 160, 20 }, { 42, 21, 159, 22 }, { 41, 23, 158, 23 },
+    { 39, 24, 157, 25 }, { 36, 26, 156, 27 }, { 34, 28, 155, 29 }, { 33, 30, 154, 30 }, { 31, 31, 153, 32 }, { 29, 33, 152, 34 },
+    { 0, 35, 67, 172 }, { 53, 0, 164, 15 }, { 51, 16, 163, 16 }, { 48, 17, 162, 18 }, { 45, 19, 161, 20 }, { 42, 21, 160, 22 },
+    { 41, 23, 159, 23 }, { 39, 24, 158, 25 }, { 36, 26, 157, 27 }, { 35, 28, 156, 28 }, { 33, 29, 155, 30 }, { 31, 31, 154, 32 },
+    { 29, 33, 153, 34 }, { 0, 35, 152, 172 }, { 53, 0, 165, 15 }, { 51, 16, 164, 16 }, { 48, 17, 163, 18 }, { 45, 19, 162, 20 },
+    { 42, 21, 161, 22 }, { 41, 23, 160, 23 }, { 39, 24, 159, 25 }, { 36, 26, 158, 27 }, { 35, 28, 157, 28 }, { 33, 29, 156, 30 },
+    { 31, 31, 155, 32 }, { 30, 33, 154, 33 }, { 0, 34, 153, 172 }, { 53, 0, 166, 15 }, { 50, 16, 165, 17 }, { 48, 18, 164, 18 },
+    { 45, 19, 163, 20 }, { 42, 21, 162, 22 }, { 41, 23, 161, 23 }, { 39, 24, 160, 25 }, { 36, 26, 159, 27 }, { 35, 28, 158, 28 },
+    { 33, 29, 157, 30 }, { 31, 31, 156, 32 }, { 30, 33, 155, 33 }, { 28, 34, 154, 35 }, { 0, 36, 65, 172 }, { 50, 0, 166, 17 },
+    { 48, 18, 165, 18 }, { 45, 19, 164, 20 }, { 42, 21, 163, 22 }, { 41, 23, 162, 23 }, { 39, 24, 161, 25 }, { 36, 26, 160, 27 },
+    { 35, 28, 159, 28 }, { 33, 29, 158, 30 }, { 32, 31, 157, 31 }, { 30, 32, 156, 33 }, { 28, 34, 155, 35 }, { 0, 36, 154, 172 },
+    { 50, 0, 167, 17 }, { 47, 18, 166, 19 }, { 45, 20, 165, 20 }, { 42, 21, 164, 22 }, { 41, 23, 163, 23 }, { 39, 24, 162, 25 },
+    { 36, 26, 161, 27 }, { 35, 28, 160, 28 }, { 33, 29, 159, 30 }, { 32, 31, 158, 31 }, { 30, 32, 157, 33 }, { 28, 34, 156, 35 },
+    { 27, 36, 155, 36 }, { 0, 37, 64, 172 }, { 50, 0, 168, 17 }, { 47, 18, 167, 19 }, { 45, 20, 166, 20 }, { 42, 21, 165, 22 },
+    { 41, 23, 164, 23 }, { 39, 24, 163, 25 }, { 36, 26, 162, 27 }, { 35, 28, 161, 28 }, { 33, 29, 160, 30 }, { 32, 31, 159, 31 },
+    { 30, 32, 158, 33 }, { 29, 34, 157, 34 }, { 27, 35, 156, 36 }, { 0, 37, 155, 172 }, { 50, 0, 169, 17 }, { 47, 18, 168, 19 },
+    { 45, 20, 167, 20 }, { 42, 21, 166, 22 }, { 40, 23, 165, 24 }, { 39, 25, 164, 25 }, { 36, 26, 163, 27 }, { 35, 28, 162, 28 },
+    { 33, 29, 161, 30 }, { 32, 31, 160, 31 }, { 30, 32, 159, 33 }, { 29, 34, 158, 34 }, { 27, 35, 157, 36 }, { 0, 37, 156, 172 },
+    { 48, 0, 170, 18 }, { 47, 19, 169, 19 }, { 44, 20, 168, 21 }, { 42, 22, 167, 22 }, { 40, 23, 166, 24 }, { 39, 25, 165, 25 },
+    { 36, 26, 164, 27 }, { 35, 28, 163, 28 }, { 33, 29, 162, 30 }, { 32, 31, 161, 31 }, { 30, 32, 160, 33 }, { 29, 34, 159, 34 },
+    { 27, 35, 158, 36 }, { 27, 37, 157, 37 }, { 0, 38, 62, 172 }, { 48, 0, 171, 18 }, { 47, 19, 170, 19 }, { 44, 20, 169, 21 },
+    { 42, 22, 168, 22 }, { 40, 23, 167, 24 }, { 39, 25, 166, 25 }, { 36, 26, 165, 27 }, { 35, 28, 164, 28 }, { 33, 29, 163, 30 },
+    { 32, 31, 162, 31 }, { 30, 32, 161, 33 }, { 29, 34, 160, 34 }, { 27, 35, 159, 36 }, { 27, 37, 158, 37 }, { 0, 38, 157, 172 },
+    { 45, 0, 171, 20 }, { 44, 21, 170, 21 }, { 42, 22, 169, 22 }, { 40, 23, 168, 24 }, { 39, 25, 167, 25 }, { 36, 26, 166, 27 },
+    { 35, 28, 165, 28 }, { 33, 29, 164, 30 }, { 32, 31, 163, 31 }, { 30, 32, 162, 33 }, { 29, 34, 161, 34 }, { 27, 35, 160, 36 },
+    { 27, 37, 159, 37 }, { 26, 38, 158, 38 }, { 0, 39, 61, 172 }, { 45, 0, 172, 20 }, { 44, 21, 171, 21 }, { 41, 22, 170, 23 },
+    { 40, 24, 169, 24 }, { 39, 25, 168, 25 }, { 36, 26, 167, 27 }, { 35, 28, 166, 28 }, { 33, 29, 165, 30 }, { 32, 31, 164, 31 },
+    { 30, 32, 163, 33 }, { 29, 34, 162, 34 }, { 28, 35, 161, 35 }, { 27, 36, 160, 37 }, { 26, 38, 159, 38 }, { 0, 39, 158, 172 },
+    { 45, 0, 173, 20 }, { 44, 21, 172, 21 }, { 41, 22, 171, 23 }, { 40, 24, 170, 24 }, { 38, 25, 169, 26 }, { 36, 27, 168, 27 },
+    { 35, 28, 167, 28 }, { 33, 29, 166, 30 }, { 32, 31, 165, 31 }, { 30, 32, 164, 33 }, { 29, 34, 163, 34 }, { 28, 35, 162, 35 },
+    { 27, 36, 161, 37 }, { 26, 38, 160, 38 }, { 0, 39, 159, 172 }, { 45, 0, 174, 20 }, { 42, 21, 173, 22 }, { 41, 23, 172, 23 },
+    { 40, 24, 171, 24 }, { 38, 25, 170, 26 }, { 36, 27, 169, 27 }, { 35, 28, 168, 28 }, { 33, 29, 167, 30 }, { 32, 31, 166, 31 },
+    { 30, 32, 165, 33 }, { 29, 34, 164, 34 }, { 28, 35, 163, 35 }, { 27, 36, 162, 37 }, { 26, 38, 161, 38 }, { 25, 39, 160, 39 },
+    { 0, 40, 59, 172 }, { 42, 0, 174, 22 }, { 41, 23, 173, 23 }, { 39, 24, 172, 25 }, { 38, 26, 171, 26 }, { 36, 27, 170, 27 },
+    { 34, 28, 169, 29 }, { 33, 30, 168, 30 }, { 32, 31, 167, 31 }, { 30, 32, 166, 33 }, { 29, 34, 165, 34 }, { 28, 35, 164, 35 },
+    { 27, 36, 163, 37 }, { 26, 38, 162, 38 }, { 25, 39, 161, 39 }, { 0, 40, 160, 172 }, { 42, 0, 175, 22 }, { 41, 23, 174, 23 },
+    { 39, 24, 173, 25 }, { 38, 26, 172, 26 }, { 36, 27, 171, 27 }, { 34, 28, 170, 29 }, { 33, 30, 169, 30 }, { 32, 31, 168, 31 },
+    { 30, 32, 167, 33 }, { 29, 34, 166, 34 }, { 28, 35, 165, 35 }, { 27, 36, 164, 37 }, { 26, 38, 163, 38 }, { 25, 39, 162, 39 },
+    { 0, 40, 161, 172 }, { 42, 0, 176, 22 }, { 40, 23, 175, 24 }, { 39, 25, 174, 25 }, { 38, 26, 173, 26 }, { 35, 27, 172, 28 },
+    { 34, 29, 171, 29 }, { 33, 30, 170, 30 }, { 32, 31, 169, 31 }, { 30, 32, 168, 33 }, { 29, 34, 167, 34 }, { 28, 35, 166, 35 },
+    { 27, 36, 165, 37 }, { 26, 38, 164, 38 }, { 25, 39, 163, 39 }, { 23, 40, 162, 41 }, { 0, 42, 57, 172 }, { 41, 0, 177, 23 },
+    { 40, 24, 176, 24 }, { 39, 25, 175, 25 }, { 38, 26, 174, 26 }, { 35, 27, 173, 28 }, { 34, 29, 172, 29 }, { 33, 30, 171, 30 },
+    { 31, 31, 170, 32 }, { 30, 33, 169, 33 }, { 29, 34, 168, 34 }, { 28, 35, 167, 35 }, { 27, 36, 166, 37 }, { 26, 38, 165, 38 },
+    { 25, 39, 164, 39 }, { 23, 40, 163, 41 }, { 0, 42, 162, 172 }, { 41, 0, 178, 23 }, { 40, 24, 177, 24 }, { 39, 25, 176, 25 },
+    { 36, 26, 175, 27 }, { 35, 28, 174, 28 }, { 34, 29, 173, 29 }, { 33, 30, 172, 30 }, { 31, 31, 171, 32 }, { 30, 33, 170, 33 },
+    { 29, 34, 169, 34 }, { 28, 35, 168, 35 }, { 27, 36, 167, 37 }, { 26, 38, 166, 38 }, { 25, 39, 165, 39 }, { 24, 40, 164, 40 },
+    { 0, 41, 163, 172 }, { 40, 0, 178, 24 }, { 38, 25, 177, 26 }, { 36, 27, 176, 27 }, { 35, 28, 175, 28 }, { 34, 29, 174, 29 },
+    { 32, 30, 173, 31 }, { 31, 32, 172, 32 }, { 30, 33, 171, 33 }, { 29, 34, 170, 34 }, { 27, 35, 169, 36 }, { 27, 37, 168, 37 },
+    { 26, 38, 167, 38 }, { 25, 39, 166, 39 }, { 24, 40, 165, 40 }, { 22, 41, 164, 42 }, { 0, 43, 55, 172 }, { 39, 0, 179, 25 },
+    { 38, 26, 178, 26 }, { 36, 27, 177, 27 }, { 35, 28, 176, 28 }, { 33, 29, 175, 30 }, { 32, 31, 174, 31 }, { 31, 32, 173, 32 },
+    { 30, 33, 172, 33 }, { 29, 34, 171, 34 }, { 27, 35, 170, 36 }, { 27, 37, 169, 37 }, { 26, 38, 168, 38 }, { 25, 39, 167, 39 },
+    { 24, 40, 166, 40 }, { 22, 41, 165, 42 }, { 0, 43, 164, 172 }, { 39, 0, 180, 25 }, { 38, 26, 179, 26 }, { 36, 27, 178, 27 },
+    { 34, 28, 177, 29 }, { 33, 30, 176, 30 }, { 32, 31, 175, 31 }, { 31, 32, 174, 32 }, { 30, 33, 173, 33 }, { 28, 34, 172, 35 },
+    { 27, 36, 171, 36 }, { 27, 37, 170, 37 }, { 26, 38, 169, 38 }, { 25, 39, 168, 39 }, { 24, 40, 167, 40 }, { 22, 41, 166, 42 },
+    { 22, 43, 165, 43 }, { 0, 44, 54, 172 }, { 38, 0, 180, 26 }, { 35, 27, 179, 28 }, { 34, 29, 178, 29 }, { 33, 30, 177, 30 },
+    { 32, 31, 176, 31 }, { 31, 32, 175, 32 }, { 30, 33, 174, 33 }, { 28, 34, 173, 35 }, { 27, 36, 172, 36 }, { 27, 37, 171, 37 },
+    { 26, 38, 170, 38 }, { 25, 39, 169, 39 }, { 23, 40, 168, 41 }, { 22, 42, 167, 42 }, { 22, 43, 166, 43 }, { 0, 44, 165, 172 },
+    { 36, 0, 181, 27 }, { 35, 28, 180, 28 }, { 34, 29, 179, 29 }, { 33, 30, 178, 30 }, { 32, 31, 177, 31 }, { 30, 32, 176, 33 },
+    { 29, 34, 175, 34 }, { 28, 35, 174, 35 }, { 27, 36, 173, 36 }, { 27, 37, 172, 37 }, { 26, 38, 171, 38 }, { 25, 39, 170, 39 },
+    { 23, 40, 169, 41 }, { 22, 42, 168, 42 }, { 22, 43, 167, 43 }, { 21, 44, 166, 44 }, { 0, 45, 53, 172 }, { 36, 0, 182, 27 },
+    { 35, 28, 181, 28 }, { 34, 29, 180, 29 }, { 33, 30, 179, 30 }, { 31, 31, 178, 32 }, { 30, 33, 177, 33 }, { 29, 34, 176, 34 },
+    { 28, 35, 175, 35 }, { 27, 36, 174, 36 }, { 27, 37, 173, 37 }, { 26, 38, 172, 38 }, { 25, 39, 171, 39 }, { 23, 40, 170, 41 },
+    { 22, 42, 169, 42 }, { 22, 43, 168, 43 }, { 21, 44, 167, 44 }, { 0, 45, 166, 172 }, { 36, 0, 183, 27 }, { 35, 28, 182, 28 },
+    { 33, 29, 181, 30 }, { 32, 31, 180, 31 }, { 31, 32, 179, 32 }, { 30, 33, 178, 33 }, { 29, 34, 177, 34 }, { 28, 35, 176, 35 },
+    { 27, 36, 175, 36 }, { 27, 37, 174, 37 }, { 26, 38, 173, 38 }, { 24, 39, 172, 40 }, { 23, 41, 171, 41 }, { 22, 42, 170, 42 },
+    { 22, 43, 169, 43 }, { 21, 44, 168, 44 }, { 20, 45, 167, 45 }, { 0, 46, 52, 172 }, { 35, 0, 184, 28 }, { 34, 29, 183, 29 },
+    { 33, 30, 182, 30 }, { 32, 31, 181, 31 }, { 31, 32, 180, 32 }, { 30, 33, 179, 33 }, { 29, 34, 178, 34 }, { 28, 35, 177, 35 },
+    { 27, 36, 176, 36 }, { 26, 37, 175, 38 }, { 25, 39, 174, 39 }, { 24, 40, 173, 40 }, { 23, 41, 172, 41 }, { 22, 42, 171, 42 },
+    { 22, 43, 170, 43 }, { 21, 44, 169, 44 }, { 20, 45, 168, 45 }, { 0, 46, 167, 172 }, { 34, 0, 184, 29 }, { 33, 30, 183, 30 },
+    { 32, 31, 182, 31 }, { 31, 32, 181, 32 }, { 30, 33, 180, 33 }, { 29, 34, 179, 34 }, { 27, 35, 178, 36 }, { 27, 37, 177, 37 },
+    { 26, 38, 176, 38 }, { 25, 39, 175, 39 }, { 24, 40, 174, 40 }, { 23, 41, 173, 41 }, { 22, 42, 172, 42 }, { 22, 43, 171, 43 },
+    { 21, 44, 170, 44 }, { 20, 45, 169, 45 }, { 20, 46, 168, 46 }, { 0, 47, 51, 172 }, { 34, 0, 185, 29 }, { 33, 30, 184, 30 },
+    { 31, 31, 183, 32 }, { 30, 33, 182, 33 }, { 29, 34, 181, 34 }, { 28, 35, 180, 35 }, { 27, 36, 179, 36 }, { 27, 37, 178, 37 },
+    { 26, 38, 177, 38 }, { 25, 39, 176, 39 }, { 24, 40, 175, 40 }, { 23, 41, 174, 41 }, { 22, 42, 173, 42 }, { 22, 43, 172, 43 },
+    { 21, 44, 171, 44 }, { 20, 45, 170, 45 }, { 20, 46, 169, 46 }, { 0, 47, 168, 172 }, { 33, 0, 186, 30 }, { 32, 31, 185, 31 },
+    { 31, 32, 184, 32 }, { 30, 33, 183, 33 }, { 29, 34, 182, 34 }, { 28, 35, 181, 35 }, { 27, 36, 180, 36 }, { 27, 37, 179, 37 },
+    { 26, 38, 178, 38 }, { 25, 39, 177, 39 }, { 24, 40, 176, 40 }, { 23, 41, 175, 41 }, { 22, 42, 174, 42 }, { 22, 43, 173, 43 },
+    { 21, 44, 172, 44 }, { 20, 45, 171, 45 }, { 20, 46, 170, 46 }, { 19, 47, 169, 47 }, { 0, 48, 50, 172 }, { 32, 0, 186, 31 },
+    { 31, 32, 185, 32 }, { 30, 33, 184, 33 }, { 29, 34, 183, 34 }, { 28, 35, 182, 35 }, { 27, 36, 181, 36 }, { 27, 37, 180, 37 },
+    { 26, 38, 179, 38 }, { 25, 39, 178, 39 }, { 24, 40, 177, 40 }, { 23, 41, 176, 41 }, { 22, 42, 175, 42 }, { 22, 43, 174, 43 },
+    { 21, 44, 173, 44 }, { 20, 45, 172, 45 }, { 20, 46, 171, 46 }, { 19, 47, 170, 47 }, { 0, 48, 169, 172 }, { 32, 0, 187, 31 },
+    { 31, 32, 186, 32 }, { 30, 33, 185, 33 }, { 29, 34, 184, 34 }, { 28, 35, 183, 35 }, { 27, 36, 182, 36 }, { 27, 37, 181, 37 },
+    { 26, 38, 180, 38 }, { 25, 39, 179, 39 }, { 24, 40, 178, 40 }, { 23, 41, 177, 41 }, { 22, 42, 176, 42 }, { 22, 43, 175, 43 },
+    { 21, 44, 174, 44 }, { 20, 45, 173, 45 }, { 20, 46, 172, 46 }, { 19, 47, 171, 47 }, { 18, 48, 170, 48 }, { 0, 49, 49, 172 },
+    { 31, 0, 188, 32 }, { 30, 33, 187, 33 }, { 29, 34, 186, 34 }, { 28, 35, 185, 35 }, { 27, 36, 184, 36 }, { 27, 37, 183, 37 },
+    { 26, 38, 182, 38 }, { 25, 39, 181, 39 }, { 24, 40, 180, 40 }, { 23, 41, 179, 41 }, { 22, 42, 178, 42 }, { 22, 43, 177, 43 },
+    { 21, 44, 176, 44 }, { 20, 45, 175, 45 }, { 20, 46, 174, 46 }, { 19, 47, 173, 47 }, { 18, 48, 172, 48 }, { 18, 49, 171, 49 },
+    { 0, 50, 48, 172 }, { 30, 0, 188, 33 }, { 29, 34, 187, 34 }, { 28, 35, 186, 35 }, { 27, 36, 185, 36 }, { 27, 37, 184, 37 },
+    { 26, 38, 183, 38 }, { 25, 39, 182, 39 }, { 24, 40, 181, 40 }, { 23, 41, 180, 41 }, { 22, 42, 179, 42 }, { 22, 43, 178, 43 },
+    { 21, 44, 177, 44 }, { 20, 45, 176, 45 }, { 20, 46, 175, 46 }, { 19, 47, 174, 47 }, { 18, 48, 173, 48 }, { 18, 49, 172, 49 },
+    { 0, 50, 171, 172 }, { 29, 0, 189, 34 }, { 28, 35, 188, 35 }, { 27, 36, 186, 36 }, { 27, 37, 185, 37 }, { 26, 38, 184, 38 },
+    { 25, 39, 183, 39 }, { 24, 40, 182, 40 }, { 23, 41, 181, 41 }, { 22, 42, 180, 42 }, { 22, 43, 179, 43 }, { 21, 44, 178, 44 },
+    { 20, 45, 177, 45 }, { 20, 46, 176, 46 }, { 19, 47, 175, 47 }, { 18, 48, 174, 48 }, { 18, 49, 173, 49 }, { 17, 50, 172, 50 },
+    { 0, 51, 47, 172 }, { 29, 0, 190, 34 }, { 28, 35, 189, 35 }, { 27, 36, 188, 36 }, { 27, 37, 187, 37 }, { 26, 38, 186, 38 },
+    { 25, 39, 185, 39 }, { 24, 40, 184, 40 }, { 23, 41, 182, 41 }, { 22, 42, 181, 42 }, { 22, 43, 180, 43 }, { 21, 44, 179, 44 },
+    { 20, 45, 178, 45 }, { 20, 46, 177, 46 }, { 19, 47, 176, 47 }, { 18, 48, 175, 48 }, { 18, 49, 174, 49 }, { 17, 50, 173, 50 },
+    { 0, 51, 172, 172 }, { 28, 0, 190, 35 }, { 27, 36, 189, 36 }, { 27, 37, 188, 37 }, { 26, 38, 187, 38 }, { 25, 39, 186, 39 },
+    { 24, 40, 185, 40 }, { 23, 41, 184, 41 }, { 22, 42, 183, 42 }, { 22, 43, 182, 43 }, { 21, 44, 180, 44 }, { 20, 45, 179, 45 },
+    { 20, 46, 178, 46 }, { 19, 47, 177, 47 }, { 18, 48, 176, 48 }, { 18, 49, 175, 49 }, { 17, 50, 174, 50 }, { 16, 51, 173, 51 },
+    { 0, 52, 46, 172 }, { 27, 0, 191, 36 }, { 27, 37, 190, 37 }, { 26, 38, 188, 38 }, { 25, 39, 187, 39 }, { 24, 40, 186, 40 },
+    { 23, 41, 185, 41 }, { 22, 42, 184, 42 }, { 22, 43, 183, 43 }, { 21, 44, 182, 44 }, { 20, 45, 181, 45 }, { 20, 46, 180, 46 },
+    { 19, 47, 178, 47 }, { 18, 48, 177, 48 }, { 18, 49, 176, 49 }, { 17, 50, 175, 50 }, { 16, 51, 174, 51 }, { 0, 52, 173, 172 },
+    { 27, 0, 192, 36 }, { 27, 37, 191, 37 }, { 26, 38, 190, 38 }, { 25, 39, 189, 39 }, { 24, 40, 188, 40 }, { 23, 41, 186, 41 },
+    { 22, 42, 185, 42 }, { 22, 43, 184, 43 }, { 21, 44, 183, 44 }, { 20, 45, 182, 45 }, { 20, 46, 181, 46 }, { 19, 47, 180, 47 },
+    { 18, 48, 179, 48 }, { 18, 49, 177, 49 }, { 17, 50, 176, 50 }, { 16, 51, 175, 51 }, { 16, 52, 174, 52 }, { 0, 53, 45, 172 },
+    { 27, 0, 192, 37 }, { 26, 38, 191, 38 }, { 25, 39, 190, 39 }, { 24, 40, 189, 40 }, { 23, 41, 188, 41 }, { 22, 42, 187, 42 },
+    { 22, 43, 185, 43 }, { 21, 44, 184, 44 }, { 20, 45, 183, 45 }, { 20, 46, 182, 46 }, { 19, 47, 181, 47 }, { 18, 48, 180, 48 },
+    { 18, 49, 179, 49 }, { 17, 50, 177, 50 }, { 16, 51, 176, 51 }, { 16, 52, 175, 52 }, { 0, 53, 174, 172 }, { 26, 0, 193, 38 },
+    { 25, 39, 192, 39 }, { 24, 40, 190, 40 }, { 23, 41, 189, 41 }, { 22, 42, 188, 42 }, { 22, 43, 187, 43 }, { 21, 44, 186, 44 },
+    { 20, 45, 185, 45 }, { 20, 46, 183, 46 }, { 19, 47, 182, 47 }, { 18, 48, 181, 48 }, { 18, 49, 180, 49 }, { 17, 50, 179, 50 },
+    { 16, 51, 177, 51 }, { 16, 52, 176, 52 }, { 15, 53, 175, 53 }, { 0, 54, 44, 172 }, { 25, 0, 193, 39 }, { 24, 40, 192, 40 },
+    { 23, 41, 191, 41 }, { 22, 42, 189, 42 }, { 22, 43, 188, 43 }, { 21, 44, 187, 44 }, { 20, 45, 186, 45 }, { 20, 46, 185, 46 },
+    { 19, 47, 183, 47 }, { 18, 48, 182, 48 }, { 18, 49, 181, 49 }, { 17, 50, 180, 50 }, { 16, 51, 179, 51 }, { 16, 52, 178, 52 },
+    { 15, 53, 176, 53 }, { 0, 54, 175, 172 }, { 25, 0, 194, 39 }, { 24, 40, 193, 40 }, { 23, 41, 192, 41 }, { 22, 42, 191, 42 },
+    { 22, 43, 190, 43 }, { 21, 44, 188, 44 }, { 20, 45, 187, 45 }, { 20, 46, 186, 46 }, { 19, 47, 185, 47 }, { 18, 48, 184, 48 },
+    { 18, 49, 182, 49 }, { 17, 50, 181, 50 }, { 16, 51, 180, 51 }, { 16, 52, 179, 52 }, { 15, 53, 178, 53 }, { 14, 54, 176, 54 },
+    { 0, 55, 43, 172 }, { 24, 0, 195, 40 }, { 23, 41, 194, 41 }, { 22, 42, 192, 42 }, { 22, 43, 191, 43 }, { 21, 44, 190, 44 },
+    { 20, 45, 189, 45 }, { 20, 46, 187, 46 }, { 19, 47, 186, 47 }, { 18, 48, 185, 48 }, { 18, 49, 184, 49 }, { 17, 50, 182, 50 },
+    { 16, 51, 181, 51 }, { 16, 52, 180, 52 }, { 15, 53, 179, 53 }, { 14, 54, 178, 54 }, { 0, 55, 176, 172 }, { 23, 0, 195, 41 },
+    { 22, 42, 194, 42 }, { 22, 43, 193, 43 }, { 21, 44, 191, 44 }, { 20, 45, 190, 45 }, { 20, 46, 189, 46 }, { 19, 47, 188, 47 },
+    { 18, 48, 186, 48 }, { 18, 49, 185, 49 }, { 17, 50, 184, 50 }, { 16, 51, 183, 51 }, { 16, 52, 181, 52 }, { 15, 53, 180, 53 },
+    { 14, 54, 179, 54 }, { 14, 55, 178, 55 }, { 0, 56, 42, 172 }, { 23, 0, 196, 41 }, { 22, 42, 195, 42 }, { 22, 43, 194, 43 },
+    { 21, 44, 193, 44 }, { 20, 45, 192, 45 }, { 20, 46, 190, 46 }, { 19, 47, 189, 47 }, { 18, 48, 188, 48 }, { 18, 49, 186, 49 },
+    { 17, 50, 185, 50 }, { 16, 51, 184, 51 }, { 16, 52, 183, 52 }, { 15, 53, 181, 53 }, { 14, 54, 180, 54 }, { 14, 55, 179, 55 },
+    { 13, 56, 177, 56 }, { 0, 57, 42, 172 }, { 22, 0, 197, 42 }, { 22, 43, 196, 43 }, { 21, 44, 194, 44 }, { 20, 45, 193, 45 },
+    { 20, 46, 192, 46 }, { 19, 47, 190, 47 }, { 18, 48, 189, 48 }, { 18, 49, 188, 49 }, { 17, 50, 187, 50 }, { 16, 51, 185, 51 },
+    { 16, 52, 184, 52 }, { 15, 53, 183, 53 }, { 14, 54, 181, 54 }, { 14, 55, 180, 55 }, { 13, 56, 179, 56 }, { 0, 57, 177, 172 },
+    { 22, 0, 197, 43 }, { 21, 44, 196, 44 }, { 20, 45, 195, 45 }, { 20, 46, 193, 46 }, { 19, 47, 192, 47 }, { 18, 48, 191, 48 },
+    { 18, 49, 189, 49 }, { 17, 50, 188, 50 }, { 16, 51, 187, 51 }, { 16, 52, 185, 52 }, { 15, 53, 184, 53 }, { 14, 54, 183, 54 },
+    { 14, 55, 181, 55 }, { 13, 56, 180, 56 }, { 13, 57, 179, 57 }, { 0, 58, 41, 172 }, { 21, 0, 198, 44 }, { 20, 45, 196, 45 },
+    { 20, 46, 195, 46 }, { 19, 47, 193, 47 }, { 18, 48, 192, 48 }, { 18, 49, 191, 49 }, { 17, 50, 189, 50 }, { 16, 51, 188, 51 },
+    { 16, 52, 187, 52 }, { 15, 53, 185, 53 }, { 14, 54, 184, 54 }, { 14, 55, 183, 55 }, { 13, 56, 181, 56 }, { 13, 57, 180, 57 },
+    { 12, 58, 179, 58 }, { 0, 59, 40, 172 }, { 20, 0, 198, 45 }, { 20, 46, 196, 46 }, { 19, 47, 195, 47 }, { 18, 48, 194, 48 },
+    { 18, 49, 192, 49 }, { 17, 50, 191, 50 }, { 16, 51, 190, 51 }, { 16, 52, 188, 52 }, { 15, 53, 187, 53 }, { 14, 54, 185, 54 },
+    { 14, 55, 184, 55 }, { 13, 56, 183, 56 }, { 13, 57, 181, 57 }, { 12, 58, 180, 58 }, { 0, 59, 179, 172 }, { 20, 0, 199, 45 },
+    { 20, 46, 198, 46 }, { 19, 47, 197, 47 }, { 18, 48, 195, 48 }, { 18, 49, 194, 49 }, { 17, 50, 192, 50 }, { 16, 51, 191, 51 },
+    { 16, 52, 190, 52 }, { 15, 53, 188, 53 }, { 14, 54, 187, 54 }, { 14, 55, 185, 55 }, { 13, 56, 184, 56 }, { 13, 57, 183, 57 },
+    { 12, 58, 181, 58 }, { 12, 59, 180, 59 }, { 0, 60, 39, 172 }, { 20, 0, 199, 46 }, { 19, 47, 198, 47 }, { 18, 48, 197, 48 },
+    { 18, 49, 195, 49 }, { 17, 50, 194, 50 }, { 16, 51, 193, 51 }, { 16, 52, 191, 52 }, { 15, 53, 190, 53 }, { 14, 54, 188, 54 },
+    { 14, 55, 187, 55 }, { 13, 56, 185, 56 }, { 13, 57, 184, 57 }, { 12, 58, 183, 58 }, { 12, 59, 181, 59 }, { 11, 60, 180, 60 },
+    { 0, 61, 39, 172 }, { 19, 0, 200, 47 }, { 18, 48, 198, 48 }, { 18, 49, 197, 49 }, { 17, 50, 196, 50 }, { 16, 51, 194, 51 },
+    { 16, 52, 193, 52 }, { 15, 53, 191, 53 }, { 14, 54, 190, 54 }, { 14, 55, 188, 55 }, { 13, 56, 187, 56 }, { 13, 57, 185, 57 },
+    { 12, 58, 184, 58 }, { 12, 59, 182, 59 }, { 11, 60, 181, 60 }, { 0, 61, 180, 157 }, { 11, 158, 39, 172 }, { 18, 0, 200, 48 },
+    { 18, 49, 199, 49 }, { 17, 50, 197, 50 }, { 16, 51, 196, 51 }, { 16, 52, 194, 52 }, { 15, 53, 193, 53 }, { 14, 54, 191, 54 },
+    { 14, 55, 190, 55 }, { 13, 56, 188, 56 }, { 13, 57, 187, 57 }, { 12, 58, 185, 58 }, { 12, 59, 184, 59 }, { 11, 60, 182, 60 },
+    { 11, 61, 181, 61 }, { 0, 62, 39, 172 }, { 18, 0, 201, 48 }, { 18, 49, 200, 49 }, { 17, 50, 199, 50 }, { 16, 51, 197, 51 },
+    { 16, 52, 196, 52 }, { 15, 53, 194, 53 }, { 14, 54, 193, 54 }, { 14, 55, 191, 55 }, { 13, 56, 190, 56 }, { 13, 57, 188, 57 },
+    { 12, 58, 187, 58 }, { 12, 59, 185, 59 }, { 11, 60, 184, 60 }, { 11, 61, 182, 61 }, { 0, 62, 181, 156 }, { 10, 157, 39, 172 },
+    { 17, 0, 201, 50 }, { 16, 51, 199, 51 }, { 16, 52, 198, 52 }, { 15, 53, 196, 53 }, { 14, 54, 194, 54 }, { 14, 55, 193, 55 },
+    { 13, 56, 191, 56 }, { 13, 57, 190, 57 }, { 12, 58, 188, 58 }, { 12, 59, 187, 59 }, { 11, 60, 185, 60 }, { 11, 61, 184, 61 },
+    { 10, 62, 182, 62 }, { 0, 63, 39, 172 }, { 17, 0, 202, 50 }, { 16, 51, 201, 51 }, { 16, 52, 199, 52 }, { 15, 53, 198, 53 },
+    { 14, 54, 196, 54 }, { 14, 55, 195, 55 }, { 13, 56, 193, 56 }, { 13, 57, 191, 57 }, { 12, 58, 190, 58 }, { 12, 59, 188, 59 },
+    { 11, 60, 187, 60 }, { 11, 61, 185, 61 }, { 10, 62, 184, 62 }, { 10, 63, 182, 63 }, { 0, 64, 39, 172 }, { 16, 0, 203, 51 },
+    { 16, 52, 201, 52 }, { 15, 53, 199, 53 }, { 14, 54, 198, 54 }, { 14, 55, 196, 55 }, { 13, 56, 195, 56 }, { 13, 57, 193, 57 },
+    { 12, 58, 191, 58 }, { 12, 59, 190, 59 }, { 11, 60, 188, 60 }, { 11, 61, 187, 61 }, { 10, 62, 185, 62 }, { 10, 63, 183, 63 },
+    { 0, 64, 182, 154 }, { 9, 155, 39, 172 }, { 16, 0, 203, 52 }, { 15, 53, 201, 53 }, { 14, 54, 200, 54 }, { 14, 55, 198, 55 },
+    { 13, 56, 196, 56 }, { 13, 57, 195, 57 }, { 12, 58, 193, 58 }, { 12, 59, 191, 59 }, { 11, 60, 190, 60 }, { 11, 61, 188, 61 },
+    { 10, 62, 187, 62 }, { 10, 63, 185, 63 }, { 9, 64, 183, 64 }, { 0, 65, 39, 172 }, { 15, 0, 203, 53 }, { 14, 54, 201, 54 },
+    { 14, 55, 200, 55 }, { 13, 56, 198, 56 }, { 13, 57, 196, 57 }, { 12, 58, 195, 58 }, { 12, 59, 193, 59 }, { 11, 60, 191, 60 },
+    { 11, 61, 190, 61 }, { 10, 62, 188, 62 }, { 10, 63, 186, 63 }, { 9, 64, 185, 64 }, { 0, 65, 183, 153 }, { 9, 154, 39, 172 },
+    { 15, 0, 204, 53 }, { 14, 54, 203, 54 }, { 14, 55, 202, 55 }, { 13, 56, 200, 56 }, { 13, 57, 198, 57 }, { 12, 58, 196, 58 },
+    { 12, 59, 195, 59 }, { 11, 60, 193, 60 }, { 11, 61, 191, 61 }, { 10, 62, 190, 62 }, { 10, 63, 188, 63 }, { 9, 64, 186, 64 },
+    { 9, 65, 185, 65 }, { 0, 66, 39, 172 }, { 14, 0, 205, 54 }, { 14, 55, 203, 55 }, { 13, 56, 202, 56 }, { 13, 57, 200, 57 },
+    { 12, 58, 198, 58 }, { 12, 59, 196, 59 }, { 11, 60, 195, 60 }, { 11, 61, 193, 61 }, { 10, 62, 191, 62 }, { 10, 63, 190, 63 },
+    { 9, 64, 188, 64 }, { 9, 65, 186, 65 }, { 8, 66, 184, 66 }, { 0, 67, 39, 172 }, { 14, 0, 205, 55 }, { 13, 56, 204, 56 },
+    { 13, 57, 202, 57 }, { 12, 58, 200, 58 }, { 12, 59, 198, 59 }, { 11, 60, 196, 60 }, { 11, 61, 195, 61 }, { 10, 62, 193, 62 },
+    { 10, 63, 191, 63 }, { 9, 64, 189, 64 }, { 9, 65, 188, 65 }, { 8, 66, 186, 66 }, { 0, 67, 184, 151 }, { 8, 152, 39, 172 },
+    { 13, 0, 206, 56 }, { 13, 57, 204, 57 }, { 12, 58, 202, 58 }, { 12, 59, 200, 59 }, { 11, 60, 198, 60 }, { 11, 61, 196, 61 },
+    { 10, 62, 195, 62 }, { 10, 63, 193, 63 }, { 9, 64, 191, 64 }, { 9, 65, 189, 65 }, { 8, 66, 187, 66 }, { 8, 67, 186, 67 },
+    { 0, 68, 39, 172 }, { 13, 0, 206, 57 }, { 12, 58, 204, 58 }, { 12, 59, 202, 59 }, { 11, 60, 200, 60 }, { 11, 61, 198, 61 },
+    { 10, 62, 196, 62 }, { 10, 63, 195, 63 }, { 9, 64, 193, 64 }, { 9, 65, 191, 65 }, { 8, 66, 189, 66 }, { 8, 67, 187, 67 },
+    { 8, 68, 185, 68 }, { 0, 69, 39, 172 }, { 12, 0, 206, 58 }, { 12, 59, 204, 59 }, { 11, 60, 202, 60 }, { 11, 61, 200, 61 },
+    { 10, 62, 198, 62 }, { 10, 63, 196, 63 }, { 9, 64, 195, 64 }, { 9, 65, 193, 65 }, { 8, 66, 191, 66 }, { 8, 67, 189, 67 },
+    { 8, 68, 187, 68 }, { 0, 69, 185, 149 }, { 7, 150, 39, 172 }, { 12, 0, 207, 58 }, { 12, 59, 206, 59 }, { 11, 60, 204, 60 },
+    { 11, 61, 202, 61 }, { 10, 62, 200, 62 }, { 10, 63, 198, 63 }, { 9, 64, 196, 64 }, { 9, 65, 194, 65 }, { 8, 66, 193, 66 },
+    { 8, 67, 191, 67 }, { 8, 68, 189, 68 }, { 7, 69, 187, 69 }, { 0, 70, 39, 172 }, { 12, 0, 207, 59 }, { 11, 60, 206, 60 },
+    { 11, 61, 204, 61 }, { 10, 62, 202, 62 }, { 10, 63, 200, 63 }, { 9, 64, 198, 64 }, { 9, 65, 196, 65 }, { 8, 66, 194, 66 },
+    { 8, 67, 192, 67 }, { 8, 68, 190, 68 }, { 7, 69, 188, 69 }, { 7, 70, 187, 70 }, { 0, 71, 39, 172 }, { 11, 0, 208, 60 },
+    { 11, 61, 206, 61 }, { 10, 62, 204, 62 }, { 10, 63, 202, 63 }, { 9, 64, 200, 64 }, { 9, 65, 198, 65 }, { 8, 66, 196, 66 },
+    { 8, 67, 194, 67 }, { 8, 68, 192, 68 }, { 7, 69, 190, 69 }, { 7, 70, 188, 70 }, { 0, 71, 186, 147 }, { 6, 148, 39, 172 },
+    { 11, 0, 208, 61 }, { 10, 62, 206, 62 }, { 10, 63, 204, 63 }, { 9, 64, 202, 64 }, { 9, 65, 200, 65 }, { 8, 66, 198, 66 },
+    { 8, 67, 196, 67 }, { 8, 68, 194, 68 }, { 7, 69, 192, 69 }, { 7, 70, 190, 70 }, { 6, 71, 188, 71 }, { 0, 72, 39, 172 },
+    { 10, 0, 209, 62 }, { 10, 63, 206, 63 }, { 9, 64, 204, 64 }, { 9, 65, 202, 65 }, { 8, 66, 200, 66 }, { 8, 67, 198, 67 },
+    { 8, 68, 196, 68 }, { 7, 69, 194, 69 }, { 7, 70, 192, 70 }, { 6, 71, 190, 71 }, { 6, 72, 188, 72 }, { 0, 73, 39, 172 },
+    { 10, 0, 209, 63 }, { 9, 64, 207, 64 }, { 9, 65, 204, 65 }, { 8, 66, 202, 66 }, { 8, 67, 200, 67 }, { 8, 68, 198, 68 },
+    { 7, 69, 196, 69 }, { 7, 70, 194, 70 }, { 6, 71, 192, 71 }, { 6, 72, 189, 72 }, { 0, 73, 187, 145 }, { 6, 146, 39, 172 },
+    { 9, 0, 209, 64 }, { 9, 65, 207, 65 }, { 8, 66, 204, 66 }, { 8, 67, 202, 67 }, { 8, 68, 200, 68 }, { 7, 69, 198, 69 },
+    { 7, 70, 196, 70 }, { 6, 71, 193, 71 }, { 6, 72, 191, 72 }, { 6, 73, 189, 73 }, { 0, 74, 39, 172 }, { 9, 0, 210, 64 },
+    { 9, 65, 209, 65 }, { 8, 66, 207, 66 }, { 8, 67, 204, 67 }, { 8, 68, 202, 68 }, { 7, 69, 200, 69 }, { 7, 70, 198, 70 },
+    { 6, 71, 195, 71 }, { 6, 72, 193, 72 }, { 6, 73, 191, 73 }, { 5, 74, 189, 74 }, { 0, 75, 39, 172 }, { 9, 0, 210, 65 },
+    { 8, 66, 209, 66 }, { 8, 67, 207, 67 }, { 8, 68, 204, 68 }, { 7, 69, 202, 69 }, { 7, 70, 200, 70 }, { 6, 71, 198, 71 },
+    { 6, 72, 195, 72 }, { 6, 73, 193, 73 }, { 5, 74, 191, 74 }, { 0, 75, 188, 143 }, { 5, 144, 39, 172 }, { 8, 0, 211, 66 },
+    { 8, 67, 209, 67 }, { 8, 68, 207, 68 }, { 7, 69, 204, 69 }, { 7, 70, 202, 70 }, { 6, 71, 200, 71 }, { 6, 72, 197, 72 },
+    { 6, 73, 195, 73 }, { 5, 74, 193, 74 }, { 5, 75, 190, 75 }, { 0, 76, 39, 172 }, { 8, 0, 211, 67 }, { 8, 68, 209, 68 },
+    { 7, 69, 207, 69 }, { 7, 70, 204, 70 }, { 6, 71, 202, 71 }, { 6, 72, 200, 72 }, { 6, 73, 197, 73 }, { 5, 74, 195, 74 },
+    { 5, 75, 192, 75 }, { 5, 76, 190, 76 }, { 0, 77, 39, 172 }, { 8, 0, 211, 68 }, { 7, 69, 209, 69 }, { 7, 70, 207, 70 },
+    { 6, 71, 204, 71 }, { 6, 72, 202, 72 }, { 6, 73, 199, 73 }, { 5, 74, 197, 74 }, { 5, 75, 194, 75 }, { 5, 76, 192, 76 },
+    { 4, 77, 189, 77 }, { 0, 78, 39, 172 }, { 7, 0, 212, 69 }, { 7, 70, 209, 70 }, { 6, 71, 207, 71 }, { 6, 72, 204, 72 },
+    { 6, 73, 202, 73 }, { 5, 74, 199, 74 }, { 5, 75, 197, 75 }, { 5, 76, 194, 76 }, { 4, 77, 192, 77 }, { 0, 78, 189, 140 },
+    { 4, 141, 39, 172 }, { 7, 0, 212, 70 }, { 6, 71, 209, 71 }, { 6, 72, 207, 72 }, { 6, 73, 204, 73 }, { 5, 74, 201, 74 },
+    { 5, 75, 199, 75 }, { 5, 76, 196, 76 }, { 4, 77, 194, 77 }, { 4, 78, 191, 78 }, { 0, 79, 39, 172 }, { 6, 0, 212, 71 },
+    { 6, 72, 209, 72 }, { 6, 73, 207, 73 }, { 5, 74, 204, 74 }, { 5, 75, 201, 75 }, { 5, 76, 199, 76 }, { 4, 77, 196, 77 },
+    { 4, 78, 193, 78 }, { 4, 79, 191, 79 }, { 0, 80, 39, 172 }, { 6, 0, 213, 71 }, { 6, 72, 212, 72 }, { 6, 73, 209, 73 },
+    { 5, 74, 207, 74 }, { 5, 75, 204, 75 }, { 5, 76, 201, 76 }, { 4, 77, 198, 77 }, { 4, 78, 196, 78 }, { 4, 79, 193, 79 },
+    { 0, 80, 190, 138 }, { 4, 139, 39, 172 }, { 6, 0, 213, 72 }, { 6, 73, 212, 73 }, { 5, 74, 209, 74 }, { 5, 75, 206, 75 },
+    { 5, 76, 204, 76 }, { 4, 77, 201, 77 }, { 4, 78, 198, 78 }, { 4, 79, 195, 79 }, { 4, 80, 192, 80 }, { 0, 81, 39, 172 },
+    { 6, 0, 213, 73 }, { 5, 74, 212, 74 }, { 5, 75, 209, 75 }, { 5, 76, 206, 76 }, { 4, 77, 203, 77 }, { 4, 78, 200, 78 },
+    { 4, 79, 198, 79 }, { 4, 80, 195, 80 }, { 3, 81, 192, 81 }, { 0, 82, 39, 172 }, { 5, 0, 214, 74 }, { 5, 75, 212, 75 },
+    { 5, 76, 209, 76 }, { 4, 77, 206, 77 }, { 4, 78, 203, 78 }, { 4, 79, 200, 79 }, { 4, 80, 197, 80 }, { 3, 81, 194, 81 },
+    { 3, 82, 191, 82 }, { 0, 83, 39, 172 }, { 5, 0, 214, 75 }, { 5, 76, 212, 76 }, { 4, 77, 209, 77 }, { 4, 78, 206, 78 },
+    { 4, 79, 203, 79 }, { 4, 80, 200, 80 }, { 3, 81, 197, 81 }, { 3, 82, 194, 82 }, { 0, 83, 191, 135 }, { 3, 136, 39, 172 },
+    { 5, 0, 214, 76 }, { 4, 77, 212, 77 }, { 4, 78, 209, 78 }, { 4, 79, 206, 79 }, { 4, 80, 203, 80 }, { 3, 81, 199, 81 },
+    { 3, 82, 196, 82 }, { 3, 83, 193, 83 }, { 0, 84, 39, 172 }, { 4, 0, 215, 77 }, { 4, 78, 212, 78 }, { 4, 79, 209, 79 },
+    { 4, 80, 205, 80 }, { 3, 81, 202, 81 }, { 3, 82, 199, 82 }, { 3, 83, 196, 83 }, { 3, 84, 192, 84 }, { 0, 85, 39, 172 },
+    { 4, 0, 215, 78 }, { 4, 79, 212, 79 }, { 4, 80, 209, 80 }, { 3, 81, 205, 81 }, { 3, 82, 202, 82 }, { 3, 83, 198, 83 },
+    { 3, 84, 195, 84 }, { 2, 85, 192, 85 }, { 0, 86, 39, 172 }, { 4, 0, 215, 79 }, { 4, 80, 212, 80 }, { 3, 81, 208, 81 },
+    { 3, 82, 205, 82 }, { 3, 83, 201, 83 }, { 3, 84, 198, 84 }, { 2, 85, 194, 85 }, { 0, 86, 39, 172 }, { 4, 0, 215, 80 },
+    { 3, 81, 212, 81 }, { 3, 82, 208, 82 }, { 3, 83, 205, 83 }, { 3, 84, 201, 84 }, { 2, 85, 197, 85 }, { 2, 86, 194, 86 },
+    { 0, 87, 39, 172 }, { 3, 0, 215, 81 }, { 3, 82, 212, 82 }, { 3, 83, 208, 83 }, { 3, 84, 204, 84 }, { 2, 85, 200, 85 },
+    { 2, 86, 197, 86 }, { 2, 87, 193, 87 }, { 0, 88, 39, 172 }, { 3, 0, 216, 81 }, { 3, 82, 215, 82 }, { 3, 83, 211, 83 },
+    { 3, 84, 208, 84 }, { 2, 85, 204, 85 }, { 2, 86, 200, 86 }, { 2, 87, 196, 87 }, { 0, 88, 39, 172 }, { 3, 0, 216, 82 },
+    { 3, 83, 215, 83 }, { 3, 84, 211, 84 }, { 2, 85, 207, 85 }, { 2, 86, 203, 86 }, { 2, 87, 199, 87 }, { 2, 88, 195, 88 },
+    { 0, 89, 39, 172 }, { 3, 0, 216, 83 }, { 3, 84, 215, 84 }, { 2, 85, 211, 85 }, { 2, 86, 207, 86 }, { 2, 87, 203, 87 },
+    { 2, 88, 199, 88 }, { 1, 89, 194, 89 }, { 0, 90, 39, 172 }, { 3, 0, 216, 84 }, { 2, 85, 215, 85 }, { 2, 86, 211, 86 },
+    { 2, 87, 206, 87 }, { 2, 88, 202, 88 }, { 1, 89, 198, 89 }, { 0, 90, 193, 128 }, { 1, 129, 39, 172 }, { 2, 0, 217, 85 },
+    { 2, 86, 215, 86 }, { 2, 87, 210, 87 }, { 2, 88, 206, 88 }, { 1, 89, 201, 89 }, { 1, 90, 197, 90 }, { 0, 91, 39, 172 },
+    { 2, 0, 217, 86 }, { 2, 87, 215, 87 }, { 2, 88, 210, 88 }, { 1, 89, 205, 89 }, { 1, 90, 201, 90 }, { 1, 91, 196, 91 },
+    { 0, 92, 39, 172 }, { 2, 0, 217, 87 }, { 2, 88, 215, 88 }, { 1, 89, 210, 89 }, { 1, 90, 205, 90 }, { 1, 91, 200, 91 },
+    { 1, 92, 195, 92 }, { 0, 93, 39, 172 }, { 2, 0, 217, 88 }, { 1, 89, 214, 89 }, { 1, 90, 209, 90 }, { 1, 91, 204, 91 },
+    { 1, 92, 199, 92 }, { 1, 93, 194, 93 }, { 0, 94, 39, 172 }, { 1, 0, 218, 89 }, { 1, 90, 214, 90 }, { 1, 91, 209, 91 },
+    { 1, 92, 203, 92 }, { 1, 93, 198, 93 }, { 0, 94, 39, 172 }, { 1, 0, 218, 90 }, { 1, 91, 214, 91 }, { 1, 92, 208, 92 },
+    { 1, 93, 203, 93 }, { 1, 94, 197, 94 }, { 0, 95, 39, 172 }, { 1, 0, 218, 91 }, { 1, 92, 214, 92 }, { 1, 93, 208, 93 },
+    { 1, 94, 202, 94 }, { 1, 95, 196, 95 }, { 0, 96, 39, 172 }, { 1, 0, 218, 92 }, { 1, 93, 213, 93 }, { 1, 94, 207, 94 },
+    { 1, 95, 201, 95 }, { 0, 96, 194, 122 }, { 0, 123, 39, 172 }, { 1, 0, 218, 93 }, { 1, 94, 213, 94 }, { 1, 95, 206, 95 },
+    { 0, 96, 199, 96 }, { 0, 97, 39, 172 }, { 1, 0, 218, 94 }, { 1, 95, 212, 95 }, { 0, 96, 205, 96 }, { 0, 97, 198, 97 },
+    { 0, 98, 39, 172 }, { 1, 0, 218, 95 }, { 0, 96, 212, 96 }, { 0, 97, 204, 97 }, { 0, 98, 196, 98 }, { 0, 99, 39, 172 },
+    { 0, 0, 219, 96 }, { 0, 97, 211, 97 }, { 0, 98, 203, 98 }, { 0, 99, 195, 99 }, { 0, 100, 39, 172 }, { 0, 0, 219, 97 },
+    { 0, 98, 210, 98 }, { 0, 99, 201, 99 }, { 0, 100, 39, 172 }, { 0, 0, 219, 97 }, { 0, 98, 218, 98 }, { 0, 99, 209, 99 },
+    { 0, 100, 199, 100 }, { 0, 101, 39, 172 }, { 0, 0, 219, 98 }, { 0, 99, 218, 99 }, { 0, 100, 208, 100 }, { 0, 101, 197, 101 },
+    { 0, 102, 39, 172 }, { 0, 0, 219, 99 }, { 0, 100, 218, 100 }, { 0, 101, 206, 101 }, { 0, 102, 195, 102 }, { 0, 103, 39, 172 },
+    { 0, 0, 219, 100 }, { 0, 101, 217, 101 }, { 0, 102, 204, 102 }, { 0, 103, 39, 172 }, { 0, 0, 219, 101 }, { 0, 102, 216, 102 },
+    { 0, 103, 202, 103 }, { 0, 104, 39, 172 }, { 0, 0, 219, 102 }, { 0, 103, 215, 103 }, { 0, 104, 199, 104 }, { 0, 105, 39, 172 },
+    { 0, 0, 219, 103 }, { 0, 104, 214, 104 }, { 0, 105, 195, 113 }, { 0, 114, 39, 172 }, { 0, 0, 219, 104 }, { 0, 105, 212, 105 },
+    { 0, 106, 39, 172 }, { 0, 0, 219, 105 }, { 0, 106, 209, 106 }, { 0, 107, 39, 172 }, { 0, 0, 219, 106 }, { 0, 107, 204, 107 },
+    { 0, 108, 39, 172 }, { 0, 0, 219, 107 }, { 0, 108, 39, 172 }, { 0, 0, 219, 108 }, { 0, 109, 39, 172 }, { 0, 0, 219, 109 },
+    { 0, 110, 39, 172 }, { 0, 0, 219, 110 }, { 0, 111, 39, 172 }, { 0, 0, 219, 111 }, { 0, 112, 39, 172 }, { 0, 0, 219, 111 },
+    { 0, 112, 39, 172 }, { 205, 112, 219, 112 }, { 0, 0, 219, 112 }, { 0, 113, 39, 172 }, { 210, 113, 219, 113 }, { 0, 0, 219, 113 },
+    { 0, 114, 39, 172 }, { 213, 114, 219, 114 }, { 0, 0, 219, 113 }, { 0, 114, 39, 172 }, { 196, 114, 219, 114 }, { 215, 115, 219, 115 },
+    { 0, 0, 219, 114 }, { 0, 115, 39, 172 }, { 200, 115, 219, 115 }, { 216, 116, 219, 116 }, { 0, 0, 219, 115 }, { 0, 116, 39, 172 },
+    { 203, 116, 219, 116 }, { 217, 117, 219, 117 }, { 0, 0, 219, 116 }, { 0, 117, 39, 172 }, { 205, 117, 219, 117 }, { 218, 118, 219, 118 },
+    { 0, 0, 219, 116 }, { 0, 117, 39, 172 }, { 196, 117, 219, 117 }, { 207, 118, 219, 118 }, { 219, 119, 219, 119 }, { 0, 0, 219, 117 },
+    { 0, 118, 39, 172 }, { 198, 118, 219, 118 }, { 209, 119, 219, 119 }, { 219, 120, 219, 120 }, { 0, 0, 219, 118 }, { 0, 119, 39, 172 },
+    { 200, 119, 219, 119 }, { 210, 120, 219, 120 }, { 219, 121, 219, 121 }, { 0, 0, 219, 119 }, { 0, 120, 39, 172 }, { 202, 120, 219, 120 },
+    { 211, 121, 219, 121 }, { 0, 0, 219, 119 }, { 0, 120, 39, 172 }, { 196, 120, 219, 120 }, { 204, 121, 219, 121 }, { 212, 122, 219, 122 },
+    { 0, 0, 219, 120 }, { 0, 121, 39, 172 }, { 197, 121, 219, 121 }, { 205, 122, 219, 122 }, { 213, 123, 219, 123 }, { 0, 0, 219, 121 },
+    { 0, 122, 39, 172 }, { 199, 122, 219, 122 }, { 206, 123, 219, 123 }, { 213, 124, 218, 124 }, { 0, 0, 219, 122 }, { 0, 123, 39, 172 },
+    { 200, 123, 219, 123 }, { 207, 124, 218, 124 }, { 214, 125, 218, 125 }, { 0, 0, 219, 122 }, { 0, 123, 39, 172 }, { 195, 123, 219, 123 },
+    { 202, 124, 218, 124 }, { 208, 125, 218, 125 }, { 214, 126, 218, 126 }, { 0, 0, 219, 123 }, { 1, 124, 39, 172 }, { 197, 124, 218, 124 },
+    { 203, 125, 218, 125 }, { 209, 126, 218, 126 }, { 215, 127, 218, 127 }, { 0, 0, 219, 124 }, { 1, 125, 39, 172 }, { 198, 125, 218, 125 },
+    { 204, 126, 218, 126 }, { 209, 127, 218, 127 }, { 215, 128, 218, 128 }, { 0, 0, 219, 125 }, { 1, 126, 39, 172 }, { 199, 126, 218, 126 },
+    { 204, 127, 218, 127 }, { 210, 128, 218, 128 }, { 215, 129, 218, 129 }, { 0, 0, 219, 125 }, { 1, 126, 39, 172 }, { 195, 126, 218, 126 },
+    { 200, 127, 218, 127 }, { 205, 128, 218, 128 }, { 210, 129, 218, 129 }, { 215, 130, 218, 130 }, { 0, 0, 219, 126 }, { 1, 127, 39, 172 },
+    { 196, 127, 218, 127 }, { 201, 128, 218, 128 }, { 206, 129, 218, 129 }, { 211, 130, 218, 130 }, { 216, 131, 217, 131 }, { 0, 0, 219, 127 },
+    { 1, 128, 39, 172 }, { 197, 128, 218, 128 }, { 202, 129, 218, 129 }, { 206, 130, 218, 130 }, { 211, 131, 217, 131 }, { 216, 132, 217, 132 },
+    { 0, 0, 219, 128 }, { 1, 129, 39, 172 }, { 198, 129, 218, 129 }, { 202, 130, 218, 130 }, { 207, 131, 217, 131 }, { 211, 132, 217, 132 },
+    { 216, 133, 217, 133 }, { 0, 0, 219, 128 }, { 1, 129, 39, 172 }, { 194, 129, 218, 129 }, { 199, 130, 218, 130 }, { 203, 131, 217, 131 },
+    { 207, 132, 217, 132 }, { 212, 133, 217, 133 }, { 216, 134, 217, 134 }, { 0, 0, 219, 129 }, { 1, 130, 39, 172 }, { 195, 130, 218, 130 },
+    { 200, 131, 217, 131 }, { 204, 132, 217, 132 }, { 208, 133, 217, 133 }, { 212, 134, 217, 134 }, { 216, 135, 216, 135 }, { 0, 0, 219, 130 },
+    { 2, 131, 39, 172 }, { 196, 131, 217, 131 }, { 200, 132, 217, 132 }, { 204, 133, 217, 133 }, { 208, 134, 217, 134 }, { 212, 135, 216, 135 },
+    { 216, 136, 216, 136 }, { 0, 0, 219, 131 }, { 2, 132, 39, 172 }, { 197, 132, 217, 132 }, { 201, 133, 217, 133 }, { 205, 134, 217, 134 },
+    { 209, 135, 216, 135 }, { 212, 136, 216, 136 }, { 216, 137, 216, 137 }, { 0, 0, 219, 131 }, { 2, 132, 39, 172 }, { 194, 132, 217, 132 },
+    { 198, 133, 217, 133 }, { 201, 134, 217, 134 }, { 205, 135, 216, 135 }, { 209, 136, 216, 136 }, { 213, 137, 216, 137 }, { 216, 138, 216, 172 },
+    { 0, 0, 219, 132 }, { 2, 133, 39, 172 }, { 195, 133, 217, 133 }, { 198, 134, 217, 134 }, { 202, 135, 216, 135 }, { 206, 136, 216, 136 },
+    { 209, 137, 216, 137 }, { 213, 138, 216, 138 }, { 0, 0, 219, 133 }, { 2, 134, 39, 172 }, { 195, 134, 217, 134 }, { 199, 135, 216, 135 },
+    { 202, 136, 216, 136 }, { 206, 137, 216, 137 }, { 209, 138, 216, 138 }, { 213, 139, 215, 139 }, { 0, 0, 219, 133 }, { 2, 134, 39, 172 },
+    { 193, 134, 217, 134 }, { 196, 135, 216, 135 }, { 199, 136, 216, 136 }, { 203, 137, 216, 137 }, { 206, 138, 216, 138 }, { 210, 139, 215, 139 },
+    { 213, 140, 215, 140 }, { 0, 0, 219, 134 }, { 3, 135, 39, 172 }, { 193, 135, 216, 135 }, { 197, 136, 216, 136 }, { 200, 137, 216, 137 },
+    { 203, 138, 216, 138 }, { 206, 139, 215, 139 }, { 210, 140, 215, 140 }, { 213, 141, 215, 141 }, { 0, 0, 219, 135 }, { 3, 136, 39, 172 },
+    { 194, 136, 216, 136 }, { 197, 137, 216, 137 }, { 200, 138, 216, 138 }, { 204, 139, 215, 139 }, { 207, 140, 215, 140 }, { 210, 141, 215, 141 },
+    { 213, 142, 215, 142 }, { 0, 0, 219, 135 }, { 3, 136, 39, 172 }, { 192, 136, 216, 136 }, { 195, 137, 216, 137 }, { 198, 138, 216, 138 },
+    { 201, 139, 215, 139 }, { 204, 140, 215, 140 }, { 207, 141, 215, 141 }, { 210, 142, 215, 142 }, { 213, 143, 214, 143 }, { 0, 0, 219, 136 },
+    { 3, 137, 39, 172 }, { 192, 137, 216, 137 }, { 195, 138, 216, 138 }, { 198, 139, 215, 139 }, { 201, 140, 215, 140 }, { 204, 141, 215, 141 },
+    { 207, 142, 215, 142 }, { 210, 143, 214, 143 }, { 213, 144, 214, 144 }, { 0, 0, 219, 137 }, { 3, 138, 39, 172 }, { 193, 138, 216, 138 },
+    { 196, 139, 215, 139 }, { 199, 140, 215, 140 }, { 201, 141, 215, 141 }, { 204, 142, 215, 142 }, { 207, 143, 214, 143 }, { 210, 144, 214, 144 },
+    { 213, 145, 214, 145 }, { 0, 0, 219, 138 }, { 4, 139, 39, 172 }, { 193, 139, 215, 139 }, { 196, 140, 215, 140 }, { 199, 141, 215, 141 },
+    { 202, 142, 215, 142 }, { 205, 143, 214, 143 }, { 207, 144, 214, 144 }, { 210, 145, 214, 145 }, { 213, 146, 213, 146 }, { 0, 0, 219, 138 },
+    { 4, 139, 39, 172 }, { 191, 139, 215, 139 }, { 194, 140, 215, 140 }, { 197, 141, 215, 141 }, { 199, 142, 215, 142 }, { 202, 143, 214, 143 },
+    { 205, 144, 214, 144 }, { 208, 145, 214, 145 }, { 210, 146, 213, 146 }, { 213, 147, 213, 147 }, { 0, 0, 219, 139 }, { 4, 140, 39, 172 },
+    { 192, 140, 215, 140 }, { 194, 141, 215, 141 }, { 197, 142, 215, 142 }, { 200, 143, 214, 143 }, { 202, 144, 214, 144 }, { 205, 145, 214, 145 },
+    { 208, 146, 213, 146 }, { 210, 147, 213, 147 }, { 213, 148, 213, 172 }, { 0, 0, 219, 140 }, { 4, 141, 39, 172 }, { 192, 141, 215, 141 },
+    { 195, 142, 215, 142 }, { 197, 143, 214, 143 }, { 200, 144, 214, 144 }, { 202, 145, 214, 145 }, { 205, 146, 213, 146 }, { 208, 147, 213, 147 },
+    { 210, 148, 213, 148 }, { 0, 0, 219, 140 }, { 4, 141, 39, 172 }, { 190, 141, 215, 141 }, { 193, 142, 215, 142 }, { 195, 143, 214, 143 },
+    { 198, 144, 214, 144 }, { 200, 145, 214, 145 }, { 203, 146, 213, 146 }, { 205, 147, 213, 147 }, { 208, 148, 213, 148 }, { 210, 149, 212, 149 },
+    { 0, 0, 219, 141 }, { 4, 142, 39, 172 }, { 190, 142, 215, 142 }, { 193, 143, 214, 143 }, { 195, 144, 214, 144 }, { 198, 145, 214, 145 },
+    { 200, 146, 213, 146 }, { 203, 147, 213, 147 }, { 205, 148, 213, 148 }, { 208, 149, 212, 149 }, { 210, 150, 212, 150 }, { 0, 0, 219, 142 },
+    { 5, 143, 39, 172 }, { 191, 143, 214, 143 }, { 193, 144, 214, 144 }, { 196, 145, 214, 145 }, { 198, 146, 213, 146 }, { 201, 147, 213, 147 },
+    { 203, 148, 213, 148 }, { 205, 149, 212, 149 }, { 208, 150, 212, 150 }, { 210, 151, 211, 151 }, { 0, 0, 219, 143 }, { 5, 144, 39, 172 },
+    { 191, 144, 214, 144 }, { 194, 145, 214, 145 }, { 196, 146, 213, 146 }, { 198, 147, 213, 147 }, { 201, 148, 213, 148 }, { 203, 149, 212, 149 },
+    { 205, 150, 212, 150 }, { 208, 151, 211, 151 }, { 210, 152, 211, 152 }, { 0, 0, 219, 143 }, { 5, 144, 39, 172 }, { 189, 144, 214, 144 },
+    { 192, 145, 214, 145 }, { 194, 146, 213, 146 }, { 196, 147, 213, 147 }, { 199, 148, 213, 148 }, { 201, 149, 212, 149 }, { 203, 150, 212, 150 },
+    { 205, 151, 211, 151 }, { 208, 152, 211, 152 }, { 210, 153, 211, 153 }, { 0, 0, 219, 144 }, { 5, 145, 39, 172 }, { 190, 145, 214, 145 },
+    { 192, 146, 213, 146 }, { 194, 147, 213, 147 }, { 196, 148, 213, 148 }, { 199, 149, 212, 149 }, { 201, 150, 212, 150 }, { 203, 151, 211, 151 },
+    { 205, 152, 211, 152 }, { 208, 153, 211, 153 }, { 210, 154, 210, 154 }, { 0, 0, 219, 145 }, { 6, 146, 39, 172 }, { 190, 146, 213, 146 },
+    { 192, 147, 213, 147 }, { 194, 148, 213, 148 }, { 197, 149, 212, 149 }, { 199, 150, 212, 150 }, { 201, 151, 211, 151 }, { 203, 152, 211, 152 },
+    { 205, 153, 211, 153 }, { 208, 154, 210, 154 }, { 210, 155, 210, 172 }, { 0, 0, 219, 145 }, { 6, 146, 39, 172 }, { 188, 146, 213, 146 },
+    { 190, 147, 213, 147 }, { 193, 148, 213, 148 }, { 195, 149, 212, 149 }, { 197, 150, 212, 150 }, { 199, 151, 211, 151 }, { 201, 152, 211, 152 },
+    { 203, 153, 211, 153 }, { 205, 154, 210, 154 }, { 208, 155, 210, 155 }, { 0, 0, 219, 146 }, { 6, 147, 39, 172 }, { 189, 147, 213, 147 },
+    { 191, 148, 213, 148 }, { 193, 149, 212, 149 }, { 195, 150, 212, 150 }, { 197, 151, 211, 151 }, { 199, 152, 211, 152 }, { 201, 153, 211, 153 },
+    { 203, 154, 210, 154 }, { 205, 155, 210, 155 }, { 207, 156, 209, 156 }, { 0, 0, 219, 147 }, { 6, 148, 39, 172 }, { 189, 148, 213, 148 },
+    { 191, 149, 212, 149 }, { 193, 150, 212, 150 }, { 195, 151, 211, 151 }, { 197, 152, 211, 152 }, { 199, 153, 211, 153 }, { 201, 154, 210, 154 },
+    { 203, 155, 210, 155 }, { 205, 156, 209, 156 }, { 207, 157, 209, 157 }, { 0, 0, 219, 147 }, { 6, 148, 39, 172 }, { 187, 148, 213, 148 },
+    { 189, 149, 212, 149 }, { 191, 150, 212, 150 }, { 193, 151, 211, 151 }, { 195, 152, 211, 152 }, { 197, 153, 211, 153 }, { 199, 154, 210, 154 },
+    { 201, 155, 210, 155 }, { 203, 156, 209, 156 }, { 205, 157, 209, 157 }, { 207, 158, 208, 158 }, { 0, 0, 219, 148 }, { 7, 149, 39, 172 },
+    { 188, 149, 212, 149 }, { 189, 150, 212, 150 }, { 191, 151, 211, 151 }, { 193, 152, 211, 152 }, { 195, 153, 211, 153 }, { 197, 154, 210, 154 },
+    { 199, 155, 210, 155 }, { 201, 156, 209, 156 }, { 203, 157, 209, 157 }, { 205, 158, 208, 158 }, { 207, 159, 208, 159 }, { 0, 0, 219, 149 },
+    { 7, 150, 39, 172 }, { 188, 150, 212, 150 }, { 190, 151, 211, 151 }, { 192, 152, 211, 152 }, { 194, 153, 211, 153 }, { 195, 154, 210, 154 },
+    { 197, 155, 210, 155 }, { 199, 156, 209, 156 }, { 201, 157, 209, 157 }, { 203, 158, 208, 158 }, { 205, 159, 208, 159 }, { 207, 160, 207, 160 },
+    { 0, 0, 219, 149 }, { 7, 150, 39, 172 }, { 186, 150, 212, 150 }, { 188, 151, 211, 151 }, { 190, 152, 211, 152 }, { 192, 153, 211, 153 },
+    { 194, 154, 210, 154 }, { 196, 155, 210, 155 }, { 197, 156, 209, 156 }, { 199, 157, 209, 157 }, { 201, 158, 208, 158 }, { 203, 159, 208, 159 },
+    { 205, 160, 207, 160 }, { 207, 161, 207, 172 }, { 0, 0, 219, 150 }, { 8, 151, 39, 172 }, { 186, 151, 211, 151 }, { 188, 152, 211, 152 },
+    { 190, 153, 211, 153 }, { 192, 154, 210, 154 }, { 194, 155, 210, 155 }, { 196, 156, 209, 156 }, { 197, 157, 209, 157 }, { 199, 158, 208, 158 },
+    { 201, 159, 208, 159 }, { 203, 160, 207, 160 }, { 205, 161, 207, 161 }, { 0, 0, 219, 151 }, { 8, 152, 39, 172 }, { 187, 152, 211, 152 },
+    { 188, 153, 211, 153 }, { 190, 154, 210, 154 }, { 192, 155, 210, 155 }, { 194, 156, 209, 156 }, { 196, 157, 209, 157 }, { 197, 158, 208, 158 },
+    { 199, 159, 208, 159 }, { 201, 160, 207, 160 }, { 203, 161, 207, 161 }, { 205, 162, 206, 162 }, { 0, 0, 219, 151 }, { 8, 152, 39, 172 },
+    { 185, 152, 211, 152 }, { 187, 153, 211, 153 }, { 189, 154, 210, 154 }, { 190, 155, 210, 155 }, { 192, 156, 209, 156 }, { 194, 157, 209, 157 },
+    { 196, 158, 208, 158 }, { 197, 159, 208, 159 }, { 199, 160, 207, 160 }, { 201, 161, 207, 161 }, { 203, 162, 206, 162 }, { 205, 163, 206, 163 },
+    { 0, 0, 219, 152 }, { 8, 153, 39, 172 }, { 185, 153, 211, 153 }, { 187, 154, 210, 154 }, { 189, 155, 210, 155 }, { 191, 156, 209, 156 },
+    { 192, 157, 209, 157 }, { 194, 158, 208, 158 }, { 196, 159, 208, 159 }, { 197, 160, 207, 160 }, { 199, 161, 207, 161 }, { 201, 162, 206, 162 },
+    { 203, 163, 206, 163 }, { 204, 164, 205, 164 }, { 0, 0, 219, 153 }, { 9, 154, 39, 172 }, { 186, 154, 210, 154 }, { 187, 155, 210, 155 },
+    { 189, 156, 209, 156 }, { 191, 157, 209, 157 }, { 192, 158, 208, 158 }, { 194, 159, 208, 159 }, { 196, 160, 207, 160 }, { 197, 161, 207, 161 },
+    { 199, 162, 206, 162 }, { 201, 163, 206, 163 }, { 203, 164, 205, 164 }, { 204, 165, 205, 165 }, { 0, 0, 219, 153 }, { 9, 154, 39, 172 },
+    { 184, 154, 210, 154 }, { 186, 155, 210, 155 }, { 187, 156, 209, 156 }, { 189, 157, 209, 157 }, { 191, 158, 208, 158 }, { 192, 159, 208, 159 },
+    { 194, 160, 207, 160 }, { 196, 161, 207, 161 }, { 197, 162, 206, 162 }, { 199, 163, 206, 163 }, { 201, 164, 205, 164 }, { 202, 165, 205, 165 },
+    { 204, 166, 204, 172 }, { 0, 0, 219, 154 }, { 9, 155, 39, 172 }, { 184, 155, 210, 155 }, { 186, 156, 209, 156 }, { 188, 157, 209, 157 },
+    { 189, 158, 208, 158 }, { 191, 159, 208, 159 }, { 192, 160, 207, 160 }, { 194, 161, 207, 161 }, { 196, 162, 206, 162 }, { 197, 163, 206, 163 },
+    { 199, 164, 205, 164 }, { 201, 165, 205, 165 }, { 202, 166, 204, 166 }, { 0, 0, 219, 154 }, { 9, 155, 39, 172 }, { 183, 155, 210, 155 },
+    { 184, 156, 209, 156 }, { 186, 157, 209, 157 }, { 188, 158, 208, 158 }, { 189, 159, 208, 159 }, { 191, 160, 207, 160 }, { 192, 161, 207, 161 },
+    { 194, 162, 206, 162 }, { 196, 163, 206, 163 }, { 197, 164, 205, 164 }, { 199, 165, 205, 165 }, { 200, 166, 204, 166 }, { 202, 167, 203, 167 },
+    { 0, 0, 219, 155 }, { 10, 156, 39, 172 }, { 183, 156, 209, 156 }, { 185, 157, 209, 157 }, { 186, 158, 208, 158 }, { 188, 159, 208, 159 },
+    { 189, 160, 207, 160 }, { 191, 161, 207, 161 }, { 192, 162, 206, 162 }, { 194, 163, 206, 163 }, { 196, 164, 205, 164 }, { 197, 165, 205, 165 },
+    { 199, 166, 204, 166 }, { 200, 167, 203, 167 }, { 202, 168, 203, 168 }, { 0, 0, 219, 156 }, { 10, 157, 39, 172 }, { 183, 157, 209, 157 },
+    { 185, 158, 208, 158 }, { 186, 159, 208, 159 }, { 188, 160, 207, 160 }, { 189, 161, 207, 161 }, { 191, 162, 206, 162 }, { 192, 163, 206, 163 },
+    { 194, 164, 205, 164 }, { 195, 165, 205, 165 }, { 197, 166, 204, 166 }, { 199, 167, 203, 167 }, { 200, 168, 203, 168 }, { 202, 169, 202, 172 },
+    { 0, 0, 219, 156 }, { 10, 157, 39, 172 }, { 182, 157, 209, 157 }, { 183, 158, 208, 158 }, { 185, 159, 208, 159 }, { 186, 160, 207, 160 },
+    { 188, 161, 207, 161 }, { 189, 162, 206, 162 }, { 191, 163, 206, 163 }, { 192, 164, 205, 164 }, { 194, 165, 205, 165 }, { 195, 166, 204, 166 },
+    { 197, 167, 203, 167 }, { 198, 168, 203, 168 }, { 200, 169, 202, 169 }, { 201, 170, 201, 170 }, { 0, 0, 219, 157 }, { 11, 158, 39, 172 },
+    { 182, 158, 208, 158 }, { 183, 159, 208, 159 }, { 185, 160, 207, 160 }, { 186, 161, 207, 161 }, { 188, 162, 206, 162 }, { 189, 163, 206, 163 },
+    { 191, 164, 205, 164 }, { 192, 165, 205, 165 }, { 194, 166, 204, 166 }, { 195, 167, 203, 167 }, { 197, 168, 203, 168 }, { 198, 169, 202, 169 },
+    { 200, 170, 201, 170 }, { 201, 171, 201, 172 }, { 0, 0, 219, 157 }, { 11, 158, 39, 172 }, { 181, 158, 208, 158 }, { 182, 159, 208, 159 },
+    { 183, 160, 207, 160 }, { 185, 161, 207, 161 }, { 186, 162, 206, 162 }, { 188, 163, 206, 163 }, { 189, 164, 205, 164 }, { 191, 165, 205, 165 },
+    { 192, 166, 204, 166 }, { 194, 167, 203, 167 }, { 195, 168, 203, 168 }, { 197, 169, 202, 169 }, { 198, 170, 201, 170 }, { 199, 171, 201, 171 },
+    { 0, 0, 219, 172 },
+};
+
+const uint16_t dial_ring_rect_first[502] = {
+    0, 0, 15, 29, 44, 57, 71, 85, 98, 111, 124, 137,
+    150, 162, 174, 186, 198, 210, 222, 233, 244, 255, 265, 276,
+    287, 297, 307, 317, 327, 336, 345, 355, 364, 373, 382, 391,
+    399, 407, 415, 422, 429, 436, 443, 450, 457, 464, 470, 476,
+    482, 488, 493, 498, 503, 508, 512, 516, 520, 524, 527, 531,
+    535, 539, 542, 545, 548, 551, 553, 555, 557, 558, 559, 560,
+    561, 562, 564, 566, 568, 571, 574, 577, 580, 584, 588, 592,
+    595, 599, 603, 607, 611, 616, 621, 626, 631, 637, 643, 649,
+    655, 662, 669, 676, 683, 691, 698, 705, 713, 721, 729, 738,
+    747, 756, 765, 775, 785, 794, 804, 814, 824, 834, 845, 856,
+    867, 878, 889, 900, 912, 924, 936, 949, 961, 973, 986, 999,
+    1012, 1026, 1039, 1053, 1067, 1081, 1096, 1111, 1126, 1141, 1156, 1171,
+    1186, 1201, 1216, 1232, 1248, 1263, 1279, 1295, 1311, 1327, 1344, 1361,
+    1379, 1396, 1414, 1432, 1450, 1468, 1486, 1504, 1521, 1539, 1556, 1573,
+    1590, 1607, 1623, 1639, 1655, 1671, 1686, 1702, 1718, 1733, 1748, 1763,
+    1778, 1793, 1808, 1822, 1837, 1850, 1864, 1878, 1891, 1904, 1917, 1930,
+    1943, 1955, 1967, 1979, 1991, 2003, 2015, 2026, 2037, 2048, 2058, 2069,
+    2080, 2090, 2100, 2110, 2120, 2129, 2138, 2148, 2157, 2166, 2175, 2184,
+    2192, 2200, 2208, 2215, 2222, 2229, 2236, 2243, 2250, 2257, 2263, 2269,
+    2275, 2281, 2286, 2291, 2296, 2301, 2305, 2309, 2313, 2317, 2320, 2324,
+    2328, 2332, 2335, 2338, 2341, 2344, 2346, 2348, 2350, 2351, 2352, 2353,
+    2354, 2355, 2357, 2359, 2361, 2364, 2367, 2370, 2373, 2377, 2381, 2385,
+    2388, 2392, 2396, 2400, 2404, 2409, 2414, 2419, 2424, 2430, 2436, 2442,
+    2448, 2455, 2462, 2469, 2476, 2484, 2491, 2498, 2506, 2514, 2522, 2531,
+    2540, 2549, 2558, 2568, 2578, 2587, 2597, 2607, 2617, 2627, 2638, 2649,
+    2660, 2671, 2682, 2693, 2705, 2717, 2729, 2742, 2754, 2766, 2779, 2792,
+    2805, 2819, 2832, 2846, 2860, 2874, 2889, 2904, 2919, 2934, 2949, 2965,
+    2980, 2995, 3011, 3027, 3043, 3059, 3075, 3092, 3108, 3125, 3142, 3160,
+    3178, 3196, 3214, 3233, 3251, 3270, 3289, 3307, 3325, 3343, 3361, 3378,
+    3396, 3413, 3430, 3446, 3463, 3479, 3495, 3512, 3528, 3544, 3560, 3575,
+    3591, 3607, 3623, 3638, 3654, 3668, 3683, 3698, 3712, 3726, 3740, 3754,
+    3768, 3781, 3794, 3807, 3820, 3833, 3846, 3858, 3870, 3882, 3893, 3905,
+    3917, 3928, 3939, 3950, 3961, 3971, 3981, 3992, 4002, 4012, 4022, 4032,
+    4041, 4050, 4059, 4067, 4075, 4083, 4091, 4099, 4107, 4115, 4122, 4129,
+    4136, 4143, 4149, 4155, 4161, 4167, 4172, 4177, 4182, 4187, 4191, 4196,
+    4201, 4206, 4210, 4214, 4218, 4222, 4225, 4228, 4231, 4233, 4235, 4237,
+    4239, 4241, 4244, 4247, 4250, 4254, 4258, 4262, 4266, 4271, 4276, 4281,
+    4285, 4290, 4295, 4300, 4305, 4311, 4317, 4323, 4329, 4336, 4343, 4350,
+    4357, 4365, 4373, 4381, 4389, 4398, 4406, 4414, 4423, 4432, 4441, 4451,
+    4461, 4471, 4481, 4492, 4503, 4513, 4524, 4535, 4546, 4557, 4569, 4581,
+    4593, 4605, 4617, 4629, 4642, 4655, 4668, 4682, 4695, 4708, 4722, 4736,
+    4750, 4765, 4779, 4794, 4809, 4824, 4840, 4856, 4872, 4873,
+};
+
+const DialRingBox dial_ring_unit_box[500] = {
+    { 19, 158, 39, 172 }, { 19, 158, 38, 171 }, { 18, 157, 38, 171 }, { 18, 157, 37, 170 }, { 17, 156, 37, 169 }, { 16, 155, 37, 168 },
+    { 16, 155, 36, 167 }, { 16, 154, 36, 166 }, { 15, 154, 35, 166 }, { 14, 153, 35, 165 }, { 14, 152, 35, 164 }, { 13, 152, 34, 163 },
+    { 13, 151, 34, 162 }, { 13, 150, 34, 161 }, { 12, 150, 33, 161 }, { 12, 149, 33, 160 }, { 11, 148, 33, 159 }, { 11, 148, 32, 158 },
+    { 10, 147, 32, 157 }, { 10, 146, 32, 156 }, { 10, 146, 31, 155 }, { 9, 145, 31, 155 }, { 9, 144, 31, 154 }, { 8, 144, 30, 153 },
+    { 8, 143, 30, 152 }, { 8, 142, 30, 151 }, { 7, 141, 30, 150 }, { 7, 141, 29, 149 }, { 7, 140, 29, 148 }, { 6, 139, 29, 148 },
+    { 6, 139, 28, 147 }, { 6, 138, 28, 146 }, { 5, 137, 28, 145 }, { 5, 136, 28, 144 }, { 5, 136, 27, 143 }, { 4, 135, 27, 142 },
+    { 4, 134, 27, 141 }, { 4, 134, 26, 140 }, { 4, 133, 27, 139 }, { 4, 132, 26, 138 }, { 3, 132, 25, 138 }, { 3, 131, 26, 137 },
+    { 3, 130, 26, 136 }, { 3, 129, 26, 135 }, { 2, 129, 25, 134 }, { 2, 128, 25, 133 }, { 2, 127, 25, 132 }, { 2, 126, 25, 131 },
+    { 1, 126, 24, 130 }, { 1, 125, 25, 129 }, { 1, 124, 25, 128 }, { 1, 123, 25, 127 }, { 1, 123, 24, 126 }, { 1, 122, 24, 125 },
+    { 1, 121, 24, 124 }, { 0, 120, 24, 123 }, { 0, 120, 23, 122 }, { 1, 119, 24, 121 }, { 0, 118, 24, 121 }, { 0, 117, 24, 120 },
+    { 0, 117, 23, 119 }, { 0, 116, 24, 118 }, { 0, 115, 24, 117 }, { 0, 114, 24, 116 }, { 0, 114, 23, 115 }, { 0, 113, 23, 114 },
+    { 0, 112, 23, 113 }, { 0, 112, 14, 112 }, { 0, 111, 23, 111 }, { 0, 110, 23, 110 }, { 0, 109, 23, 109 }, { 0, 108, 23, 108 },
+    { 0, 107, 14, 107 }, { 0, 106, 23, 107 }, { 0, 105, 23, 106 }, { 0, 104, 23, 105 }, { 0, 103, 24, 105 }, { 0, 102, 24, 104 },
+    { 0, 101, 24, 103 }, { 0, 100, 23, 102 }, { 0, 99, 24, 102 }, { 0, 98, 24, 101 }, { 1, 98, 24, 100 }, { 0, 97, 23, 99 },
+    { 0, 96, 24, 99 }, { 1, 95, 24, 98 }, { 1, 94, 24, 97 }, { 1, 93, 24, 96 }, { 1, 92, 25, 96 }, { 1, 91, 25, 95 },
+    { 1, 90, 25, 94 }, { 1, 89, 24, 93 }, { 2, 88, 25, 93 }, { 2, 87, 25, 92 }, { 2, 86, 25, 91 }, { 2, 85, 25, 90 },
+    { 3, 84, 26, 90 }, { 3, 83, 26, 89 }, { 3, 82, 26, 88 }, { 3, 81, 25, 87 }, { 4, 81, 26, 87 }, { 4, 80, 27, 86 },
+    { 4, 79, 26, 85 }, { 4, 78, 27, 85 }, { 4, 77, 27, 84 }, { 5, 76, 27, 83 }, { 5, 75, 28, 83 }, { 5, 74, 28, 82 },
+    { 6, 73, 28, 81 }, { 6, 72, 28, 80 }, { 6, 71, 29, 80 }, { 7, 71, 29, 79 }, { 7, 70, 29, 78 }, { 7, 69, 30, 78 },
+    { 8, 68, 30, 77 }, { 8, 67, 30, 76 }, { 8, 66, 30, 75 }, { 9, 65, 31, 75 }, { 9, 64, 31, 74 }, { 10, 64, 31, 73 },
+    { 10, 63, 32, 73 }, { 10, 62, 32, 72 }, { 11, 61, 32, 71 }, { 11, 60, 33, 71 }, { 12, 59, 33, 70 }, { 12, 58, 33, 69 },
+    { 13, 58, 34, 69 }, { 13, 57, 34, 68 }, { 13, 56, 34, 67 }, { 14, 55, 35, 67 }, { 14, 54, 35, 66 }, { 15, 53, 35, 65 },
+    { 16, 53, 36, 65 }, { 16, 52, 36, 64 }, { 16, 51, 37, 64 }, { 17, 50, 37, 63 }, { 18, 49, 37, 62 }, { 18, 48, 38, 62 },
+    { 19, 48, 38, 61 }, { 19, 47, 39, 61 }, { 20, 46, 39, 60 }, { 20, 45, 39, 59 }, { 21, 45, 40, 59 }, { 21, 44, 41, 58 },
+    { 22, 43, 41, 57 }, { 22, 42, 42, 57 }, { 23, 41, 42, 56 }, { 24, 41, 42, 55 }, { 24, 40, 43, 55 }, { 25, 39, 43, 54 },
+    { 26, 39, 44, 54 }, { 26, 38, 44, 53 }, { 27, 37, 45, 53 }, { 27, 36, 45, 52 }, { 28, 35, 46, 52 }, { 29, 35, 46, 51 },
+    { 29, 34, 47, 51 }, { 30, 33, 47, 50 }, { 31, 33, 48, 50 }, { 31, 32, 48, 49 }, { 32, 31, 49, 49 }, { 33, 31, 50, 48 },
+    { 33, 30, 50, 47 }, { 34, 29, 51, 47 }, { 35, 29, 51, 46 }, { 35, 28, 52, 46 }, { 36, 27, 52, 45 }, { 37, 27, 53, 45 },
+    { 38, 26, 53, 44 }, { 39, 26, 54, 44 }, { 39, 25, 54, 43 }, { 40, 24, 55, 43 }, { 41, 24, 55, 42 }, { 41, 23, 56, 42 },
+    { 42, 22, 57, 42 }, { 43, 22, 57, 41 }, { 44, 21, 58, 41 }, { 45, 21, 59, 40 }, { 45, 20, 59, 39 }, { 46, 20, 60, 39 },
+    { 47, 19, 61, 39 }, { 48, 19, 61, 38 }, { 48, 18, 62, 38 }, { 49, 18, 62, 37 }, { 50, 17, 63, 37 }, { 51, 16, 64, 37 },
+    { 52, 16, 64, 36 }, { 53, 16, 65, 36 }, { 53, 15, 65, 35 }, { 54, 14, 66, 35 }, { 55, 14, 67, 35 }, { 56, 13, 67, 34 },
+    { 57, 13, 68, 34 }, { 58, 13, 69, 34 }, { 58, 12, 69, 33 }, { 59, 12, 70, 33 }, { 60, 11, 71, 33 }, { 61, 11, 71, 32 },
+    { 62, 10, 72, 32 }, { 63, 10, 73, 32 }, { 64, 10, 73, 31 }, { 64, 9, 74, 31 }, { 65, 9, 75, 31 }, { 66, 8, 75, 30 },
+    { 67, 8, 76, 30 }, { 68, 8, 77, 30 }, { 69, 7, 78, 30 }, { 70, 7, 78, 29 }, { 71, 7, 79, 29 }, { 71, 6, 80, 29 },
+    { 72, 6, 80, 28 }, { 73, 6, 81, 28 }, { 74, 5, 82, 28 }, { 75, 5, 83, 28 }, { 76, 5, 83, 27 }, { 77, 4, 84, 27 },
+    { 78, 4, 85, 27 }, { 79, 4, 85, 26 }, { 80, 4, 86, 27 }, { 81, 4, 87, 26 }, { 81, 3, 87, 25 }, { 82, 3, 88, 26 },
+    { 83, 3, 89, 26 }, { 84, 3, 90, 26 }, { 85, 2, 90, 25 }, { 86, 2, 91, 25 }, { 87, 2, 92, 25 }, { 88, 2, 93, 25 },
+    { 89, 1, 93, 24 }, { 90, 1, 94, 25 }, { 91, 1, 95, 25 }, { 92, 1, 96, 25 }, { 93, 1, 96, 24 }, { 94, 1, 97, 24 },
+    { 95, 1, 98, 24 }, { 96, 0, 99, 24 }, { 97, 0, 99, 23 }, { 98, 1, 100, 24 }, { 98, 0, 101, 24 }, { 99, 0, 102, 24 },
+    { 100, 0, 102, 23 }, { 101, 0, 103, 24 }, { 102, 0, 104, 24 }, { 103, 0, 105, 24 }, { 104, 0, 105, 23 }, { 105, 0, 106, 23 },
+    { 106, 0, 107, 23 }, { 107, 0, 107, 14 }, { 108, 0, 108, 23 }, { 109, 0, 109, 23 }, { 110, 0, 110, 23 }, { 111, 0, 111, 23 },
+    { 112, 0, 112, 14 }, { 112, 0, 113, 23 }, { 113, 0, 114, 23 }, { 114, 0, 115, 23 }, { 114, 0, 116, 24 }, { 115, 0, 117, 24 },
+    { 116, 0, 118, 24 }, { 117, 0, 119, 23 }, { 117, 0, 120, 24 }, { 118, 0, 121, 24 }, { 119, 1, 121, 24 }, { 120, 0, 122, 23 },
+    { 120, 0, 123, 24 }, { 121, 1, 124, 24 }, { 122, 1, 125, 24 }, { 123, 1, 126, 24 }, { 123, 1, 127, 25 }, { 124, 1, 128, 25 },
+    { 125, 1, 129, 25 }, { 126, 1, 130, 24 }, { 126, 2, 131, 25 }, { 127, 2, 132, 25 }, { 128, 2, 133, 25 }, { 129, 2, 134, 25 },
+    { 129, 3, 135, 26 }, { 130, 3, 136, 26 }, { 131, 3, 137, 26 }, { 132, 3, 138, 25 }, { 132, 4, 138, 26 }, { 133, 4, 139, 27 },
+    { 134, 4, 140, 26 }, { 134, 4, 141, 27 }, { 135, 4, 142, 27 }, { 136, 5, 143, 27 }, { 136, 5, 144, 28 }, { 137, 5, 145, 28 },
+    { 138, 6, 146, 28 }, { 139, 6, 147, 28 }, { 139, 6, 148, 29 }, { 140, 7, 148, 29 }, { 141, 7, 149, 29 }, { 141, 7, 150, 30 },
+    { 142, 8, 151, 30 }, { 143, 8, 152, 30 }, { 144, 8, 153, 30 }, { 144, 9, 154, 31 }, { 145, 9, 155, 31 }, { 146, 10, 155, 31 },
+    { 146, 10, 156, 32 }, { 147, 10, 157, 32 }, { 148, 11, 158, 32 }, { 148, 11, 159, 33 }, { 149, 12, 160, 33 }, { 150, 12, 161, 33 },
+    { 150, 13, 161, 34 }, { 151, 13, 162, 34 }, { 152, 13, 163, 34 }, { 152, 14, 164, 35 }, { 153, 14, 165, 35 }, { 154, 15, 166, 35 },
+    { 154, 16, 166, 36 }, { 155, 16, 167, 36 }, { 155, 16, 168, 37 }, { 156, 17, 169, 37 }, { 157, 18, 170, 37 }, { 157, 18, 171, 38 },
+    { 158, 19, 171, 38 }, { 158, 19, 172, 39 }, { 159, 20, 173, 39 }, { 160, 20, 174, 39 }, { 160, 21, 174, 40 }, { 161, 21, 175, 41 },
+    { 162, 22, 176, 41 }, { 162, 22, 177, 42 }, { 163, 23, 178, 42 }, { 164, 24, 178, 42 }, { 164, 24, 179, 43 }, { 165, 25, 180, 43 },
+    { 165, 26, 180, 44 }, { 166, 26, 181, 44 }, { 166, 27, 182, 45 }, { 167, 27, 183, 45 }, { 167, 28, 184, 46 }, { 168, 29, 184, 46 },
+    { 168, 29, 185, 47 }, { 169, 30, 186, 47 }, { 169, 31, 186, 48 }, { 170, 31, 187, 48 }, { 170, 32, 188, 49 }, { 171, 33, 188, 50 },
+    { 172, 33, 189, 50 }, { 172, 34, 190, 51 }, { 173, 35, 190, 51 }, { 173, 35, 191, 52 }, { 174, 36, 192, 52 }, { 174, 37, 192, 53 },
+    { 175, 38, 193, 53 }, { 175, 39, 193, 54 }, { 176, 39, 194, 54 }, { 176, 40, 195, 55 }, { 177, 41, 195, 55 }, { 177, 41, 196, 56 },
+    { 177, 42, 197, 57 }, { 178, 43, 197, 57 }, { 178, 44, 198, 58 }, { 179, 45, 198, 59 }, { 180, 45, 199, 59 }, { 180, 46, 199, 60 },
+    { 180, 47, 200, 61 }, { 181, 48, 200, 61 }, { 181, 48, 201, 62 }, { 182, 49, 201, 62 }, { 182, 50, 202, 63 }, { 182, 51, 203, 64 },
+    { 183, 52, 203, 64 }, { 183, 53, 203, 65 }, { 184, 53, 204, 65 }, { 184, 54, 205, 66 }, { 184, 55, 205, 67 }, { 185, 56, 206, 67 },
+    { 185, 57, 206, 68 }, { 185, 58, 206, 69 }, { 186, 58, 207, 69 }, { 186, 59, 207, 70 }, { 186, 60, 208, 71 }, { 187, 61, 208, 71 },
+    { 187, 62, 209, 72 }, { 187, 63, 209, 73 }, { 188, 64, 209, 73 }, { 188, 64, 210, 74 }, { 188, 65, 210, 75 }, { 189, 66, 211, 75 },
+    { 189, 67, 211, 76 }, { 189, 68, 211, 77 }, { 189, 69, 212, 78 }, { 190, 70, 212, 78 }, { 190, 71, 212, 79 }, { 190, 71, 213, 80 },
+    { 191, 72, 213, 80 }, { 191, 73, 213, 81 }, { 191, 74, 214, 82 }, { 191, 75, 214, 83 }, { 192, 76, 214, 83 }, { 192, 77, 215, 84 },
+    { 192, 78, 215, 85 }, { 193, 79, 215, 85 }, { 192, 80, 215, 86 }, { 193, 81, 215, 87 }, { 194, 81, 216, 87 }, { 193, 82, 216, 88 },
+    { 193, 83, 216, 89 }, { 193, 84, 216, 90 }, { 194, 85, 217, 90 }, { 194, 86, 217, 91 }, { 194, 87, 217, 92 }, { 194, 88, 217, 93 },
+    { 195, 89, 218, 93 }, { 194, 90, 218, 94 }, { 194, 91, 218, 95 }, { 194, 92, 218, 96 }, { 195, 93, 218, 96 }, { 195, 94, 218, 97 },
+    { 195, 95, 218, 98 }, { 195, 96, 219, 99 }, { 196, 97, 219, 99 }, { 195, 98, 218, 100 }, { 195, 98, 219, 101 }, { 195, 99, 219, 102 },
+    { 196, 100, 219, 102 }, { 195, 101, 219, 103 }, { 195, 102, 219, 104 }, { 195, 103, 219, 105 }, { 196, 104, 219, 105 }, { 196, 105, 219, 106 },
+    { 196, 106, 219, 107 }, { 205, 107, 219, 107 }, { 196, 108, 219, 108 }, { 196, 109, 219, 109 }, { 196, 110, 219, 110 }, { 196, 111, 219, 111 },
+    { 205, 112, 219, 112 }, { 196, 112, 219, 113 }, { 196, 113, 219, 114 }, { 196, 114, 219, 115 }, { 195, 114, 219, 116 }, { 195, 115, 219, 117 },
+    { 195, 116, 219, 118 }, { 196, 117, 219, 119 }, { 195, 117, 219, 120 }, { 195, 118, 219, 121 }, { 195, 119, 218, 121 }, { 196, 120, 219, 122 },
+    { 195, 120, 219, 123 }, { 195, 121, 218, 124 }, { 195, 122, 218, 125 }, { 195, 123, 218, 126 }, { 194, 123, 218, 127 }, { 194, 124, 218, 128 },
+    { 194, 125, 218, 129 }, { 195, 126, 218, 130 }, { 194, 126, 217, 131 }, { 194, 127, 217, 132 }, { 194, 128, 217, 133 }, { 194, 129, 217, 134 },
+    { 193, 129, 216, 135 }, { 193, 130, 216, 136 }, { 193, 131, 216, 137 }, { 194, 132, 216, 138 }, { 193, 132, 215, 138 }, { 192, 133, 215, 139 },
+    { 193, 134, 215, 140 }, { 192, 134, 215, 141 }, { 192, 135, 215, 142 }, { 192, 136, 214, 143 }, { 191, 136, 214, 144 }, { 191, 137, 214, 145 },
+    { 191, 138, 213, 146 }, { 191, 139, 213, 147 }, { 190, 139, 213, 148 }, { 190, 140, 212, 148 }, { 190, 141, 212, 149 }, { 189, 141, 212, 150 },
+    { 189, 142, 211, 151 }, { 189, 143, 211, 152 }, { 189, 144, 211, 153 }, { 188, 144, 210, 154 }, { 188, 145, 210, 155 }, { 188, 146, 209, 155 },
+    { 187, 146, 209, 156 }, { 187, 147, 209, 157 }, { 187, 148, 208, 158 }, { 186, 148, 208, 159 }, { 186, 149, 207, 160 }, { 186, 150, 207, 161 },
+    { 185, 150, 206, 161 }, { 185, 151, 206, 162 }, { 185, 152, 206, 163 }, { 184, 152, 205, 164 }, { 184, 153, 205, 165 }, { 184, 154, 204, 166 },
+    { 183, 154, 203, 166 }, { 183, 155, 203, 167 }, { 182, 155, 203, 168 }, { 182, 156, 202, 169 }, { 182, 157, 201, 170 }, { 181, 157, 201, 171 },
+    { 181, 158, 200, 171 }, { 180, 158, 200, 172 },
+};
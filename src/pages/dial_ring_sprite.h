@@ -0,0 +1,50 @@
+#pragma once
+#include <stdint.h>
+#include "display/display.h"
+
+// Generated by tools/gen_dial_ring.py -- do not edit.
+// Master dial ring as two flash images plus the tables that say which
+// part of the green one to draw (see the generator).
+
+#define DIAL_RING_SIZE      220
+#define DIAL_RING_UNITS     500      // sweep in 0.5 degree steps
+#define DIAL_RING_RECTS     4873
+#define DIAL_RING_MAX_RECTS 19      // most rectangles any one value needs
+
+// Pixels are stored in the display's byte order, so a draw is a copy
+#if DISPLAY_NATIVE_SWAP
+#define DIAL_RING_CF        LV_COLOR_FORMAT_RGB565_SWAPPED
+#define DIAL_RING_RGB(v)    (uint16_t)(((v) >> 8) | (((v) & 0xFF) << 8))
+#else
+#define DIAL_RING_CF        LV_COLOR_FORMAT_RGB565
+#define DIAL_RING_RGB(v)    (uint16_t)(v)
+#endif
+
+// Image placement inside the DIAL_RING_SIZE square
+#define DIAL_RING_IMG_X     0
+#define DIAL_RING_IMG_Y     0
+#define DIAL_RING_IMG_W     220
+#define DIAL_RING_IMG_H     173
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Inclusive; a rect is in image pixels, a box in DIAL_RING_SIZE pixels
+// (x1 > x2 if the unit has no pixels)
+typedef struct {
+    uint8_t x1, y1, x2, y2;
+} DialRingBox;
+
+// DIAL_RING_CF, pre-blended on the page background
+extern const uint16_t dial_ring_bg[DIAL_RING_IMG_W * DIAL_RING_IMG_H];
+extern const uint16_t dial_ring_ind[DIAL_RING_IMG_W * DIAL_RING_IMG_H];
+
+// Green rects for u lit units: [dial_ring_rect_first[u], dial_ring_rect_first[u + 1])
+extern const DialRingBox dial_ring_rects[DIAL_RING_RECTS];
+extern const uint16_t dial_ring_rect_first[DIAL_RING_UNITS + 2];
+extern const DialRingBox dial_ring_unit_box[DIAL_RING_UNITS];
+
+#ifdef __cplusplus
+}
+#endif
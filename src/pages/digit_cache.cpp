@@ -0,0 +1,133 @@
+#include "digit_cache.h"
+#include <stdlib.h>
+#include <string.h>
+
+static uint16_t* cache_px = nullptr;        // one row of cells per glyph, stacked vertically
+static lv_image_dsc_t glyphs[DIGIT_CACHE_GLYPHS];
+static int32_t cell_w, cell_h;
+static lv_color_format_t cache_cf;
+
+static_assert(sizeof(DIGIT_CACHE_CHARS) - 1 == DIGIT_CACHE_GLYPHS, "one glyph per cached char");
+
+// A row is blank if every glyph has only background in it
+static bool row_blank(const uint16_t* px, int32_t w, int32_t h, int32_t row, uint16_t bg)
+{
+    for (int g = 0; g < DIGIT_CACHE_GLYPHS; g++) {
+        const uint16_t* r = px + (g * h + row) * w;
+        for (int32_t x = 0; x < w; x++)
+            if (r[x] != bg) return false;
+    }
+    return true;
+}
+
+bool digit_cache_build(lv_obj_t* parent, const lv_font_t* font,
+                       lv_color_t fg, lv_color_t bg)
+{
+    // Cells are kept in the display's own byte order so a draw is a copy
+    lv_color_format_t cf = lv_display_get_color_format(lv_obj_get_display(parent));
+    if (cache_px && cf == cache_cf) return true;
+
+    // Digits share the widest digit's advance; the others keep their own
+    int32_t digit_w = 0;
+    for (char c = '0'; c <= '9'; c++) {
+        int32_t dw = lv_font_get_glyph_width(font, c, 0);
+        if (dw > digit_w) digit_w = dw;
+    }
+    int32_t gw[DIGIT_CACHE_GLYPHS];
+    int32_t w = 0;              // canvas width: the widest glyph
+    for (int g = 0; g < DIGIT_CACHE_GLYPHS; g++) {
+        char c = DIGIT_CACHE_CHARS[g];
+        gw[g] = c >= '0' && c <= '9' ? digit_w : lv_font_get_glyph_width(font, c, 0);
+        if (gw[g] > w) w = gw[g];
+    }
+    int32_t h = lv_font_get_line_height(font);
+
+    // A rebuild keeps the old cells until the new ones exist
+    uint16_t* px = (uint16_t*)malloc(w * h * DIGIT_CACHE_GLYPHS * sizeof(uint16_t));
+    if (!px) return cache_px != nullptr;
+    uint16_t* old = cache_px;
+    cache_px = px;
+
+    // Let LVGL rasterize once into a throwaway canvas over our buffer
+    lv_obj_t* canvas = lv_canvas_create(parent);
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_buffer(canvas, cache_px, w, h * DIGIT_CACHE_GLYPHS, cf);
+    lv_canvas_fill_bg(canvas, bg, LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    static char text[DIGIT_CACHE_GLYPHS][2];
+    for (int g = 0; g < DIGIT_CACHE_GLYPHS; g++) {
+        text[g][0] = DIGIT_CACHE_CHARS[g];
+
+        lv_draw_label_dsc_t dsc;
+        lv_draw_label_dsc_init(&dsc);
+        dsc.font = font;
+        dsc.color = fg;
+        dsc.align = LV_TEXT_ALIGN_CENTER;
+        dsc.text = text[g];
+
+        lv_area_t coords = { 0, g * h, w - 1, g * h + h - 1 };
+        lv_draw_label(&layer, &dsc, &coords);
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_obj_delete(canvas);
+
+    // Crop the line box down to the rows the glyphs actually use
+    uint16_t bgpx = lv_color_to_u16(bg);
+    if (cf == LV_COLOR_FORMAT_RGB565_SWAPPED) bgpx = (uint16_t)(bgpx << 8 | bgpx >> 8);
+    int32_t top = 0, bottom = h - 1;
+    while (top < bottom && row_blank(cache_px, w, h, top, bgpx)) top++;
+    while (bottom > top && row_blank(cache_px, w, h, bottom, bgpx)) bottom--;
+    int32_t ch = bottom - top + 1;
+
+    for (int g = 0; g < DIGIT_CACHE_GLYPHS; g++)
+        memmove(cache_px + g * ch * w, cache_px + (g * h + top) * w, ch * w * sizeof(uint16_t));
+
+    // Give the cropped-off rows back to the heap
+    uint16_t* shrunk = (uint16_t*)realloc(cache_px, w * ch * DIGIT_CACHE_GLYPHS * sizeof(uint16_t));
+    if (shrunk) cache_px = shrunk;
+
+    cell_w = digit_w;
+    cell_h = ch;
+    cache_cf = cf;
+
+    // A narrower glyph is the centre columns of its row, at the full stride
+    for (int g = 0; g < DIGIT_CACHE_GLYPHS; g++) {
+        lv_image_dsc_t& img = glyphs[g];
+        memset(&img, 0, sizeof(img));
+        img.header.magic = LV_IMAGE_HEADER_MAGIC;
+        img.header.cf = cf;
+        img.header.w = gw[g];
+        img.header.h = ch;
+        img.header.stride = w * sizeof(uint16_t);
+        img.data_size = ((ch - 1) * w + gw[g]) * sizeof(uint16_t);
+        img.data = (const uint8_t*)(cache_px + g * ch * w + (w - gw[g]) / 2);
+    }
+    free(old);
+
+    return true;
+}
+
+const lv_image_dsc_t* digit_cache_get(int digit)
+{
+    return &glyphs[digit];
+}
+
+const lv_image_dsc_t* digit_cache_glyph(char c)
+{
+    const char* at = c ? strchr(DIGIT_CACHE_CHARS, c) : nullptr;
+    return at ? &glyphs[at - DIGIT_CACHE_CHARS] : nullptr;
+}
+
+int32_t digit_cache_cell_w()
+{
+    return cell_w;
+}
+
+int32_t digit_cache_cell_h()
+{
+    return cell_h;
+}
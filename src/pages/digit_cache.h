@@ -0,0 +1,28 @@
+#pragma once
+#include <lvgl.h>
+
+// ---------------- Digit glyph cache ----------------
+// The ten digits of a font, plus the sign and point the dB readout
+// needs, rendered once (anti-aliased by LVGL itself) and pre-blended
+// against a fixed background into opaque RGB565, in the byte order of
+// the parent's display (RGB565_SWAPPED with DISPLAY_NATIVE_SWAP).
+// Drawing a glyph is then a plain image blit instead of re-rasterizing
+// it. Digits share one cell size: the widest advance by the rows any
+// glyph touches; '+', '-' and '.' keep their own advance at that height.
+
+#define DIGIT_CACHE_CHARS   "0123456789+-."
+#define DIGIT_CACHE_GLYPHS  13
+
+// Builds once; called again after the display's color format changed,
+// it rebuilds in place (same descriptors, new pixels).
+bool digit_cache_build(lv_obj_t* parent, const lv_font_t* font,
+                       lv_color_t fg, lv_color_t bg);
+
+const lv_image_dsc_t* digit_cache_get(int digit);
+
+// Any of DIGIT_CACHE_CHARS; null for anything else. The image's
+// header.w is the glyph's advance.
+const lv_image_dsc_t* digit_cache_glyph(char c);
+
+int32_t digit_cache_cell_w();
+int32_t digit_cache_cell_h();
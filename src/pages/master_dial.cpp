@@ -2,33 +2,366 @@
 #include "master_dial.h"
 #include <lvgl.h>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include "protocol/helix_protocol.h"
+#include "log/binlog.h"
+#include "log/lat_trace.h"
+#include "model/params.h"
+#include "digit_cache.h"
+#include "dial_ring_sprite.h"
+#include "db_table.h"
 
 // ---------------- Internal State (private to this file) ----------------
 static lv_obj_t* dial_arc;
-static lv_obj_t* dial_label;
+static lv_obj_t* dial_cells[DIAL_CELLS];
 static lv_obj_t* dial_function;
+static lv_obj_t* dial_db_unit;                  // DIAL_READOUT_DB: "dB"
 static const lv_color_t DIAL_BG_COLOR        = lv_color_hex(0x000000);  // Black
 static const lv_color_t DIAL_ARC_MAIN_COLOR  = lv_color_hex(0xCCCCCC);  // Light gray
 static const lv_color_t DIAL_ARC_IND_COLOR   = lv_color_hex(0x44CC44);  // Green
 static const lv_color_t DIAL_FONT_COLOR      = lv_color_hex(0xFFFFFF);  // White
-static int dial_value = 50;
+static int dial_value = -1;                     // shown index; -1 = nothing yet
+static int dial_max = 120;                      // index at full sweep
+
+// Centre value as one cell per character, the index digits or the dB
+// string ("-12.5"): a detent only re-renders the cells whose character
+// changed instead of the whole 48px label
+static const lv_font_t* const DIAL_FONT = &lv_font_montserrat_48;
+static int32_t digit_cell_w;
+static int32_t cell_y;                          // readout centre, from the page centre
+static bool cells_cached;                       // images from digit_cache vs labels
+static char shown_text[DIAL_CELLS];             // what each cell holds
+static int shown_len;
+
+#if DIAL_RING_SPRITE
+// Ring drawn straight from the flash images; dial_arc is a plain object
+// whose draw callback lights the green image up to ring_units
+static lv_image_dsc_t ring_img_bg, ring_img_ind;
+static uint16_t* ring_px_swapped;               // both images, if the display's order isn't the build's
+static int ring_units;
+#endif
+
+// Invalidation instrumentation
+static DialInvStats inv_stats;
+static uint32_t inv_px_acc;
 
 // ---------------- Internal Helper ----------------
-static inline void dial_update_label(int dial_value) {
-    char buf[8];
-    snprintf(buf, sizeof(buf), "%d", dial_value);
-    lv_label_set_text(dial_label, buf);
+static void dial_inv_event_cb(lv_event_t* e)
+{
+    const lv_area_t* a = (const lv_area_t*)lv_event_get_param(e);
+    uint32_t px = lv_area_get_width(a) * lv_area_get_height(a);
+    inv_px_acc += px;
+    inv_stats.total_px += px;
+    lat_trace_mark(LAT_INVAL);
+}
+
+// Label fallback: a static one-character string per cacheable char
+static const char* cell_text(char c)
+{
+    static const char text[] = "0\0" "1\0" "2\0" "3\0" "4\0" "5\0" "6\0" "7\0" "8\0" "9\0"
+                               "+\0" "-\0" ".";
+    const char* at = c ? strchr(DIGIT_CACHE_CHARS, c) : nullptr;
+    return at ? text + 2 * (at - DIGIT_CACHE_CHARS) : "";
+}
+
+static int32_t cell_width(char c)
+{
+    if (cells_cached) {
+        const lv_image_dsc_t* g = digit_cache_glyph(c);
+        return g ? g->header.w : 0;
+    }
+    if (c >= '0' && c <= '9') return digit_cell_w;
+    return c ? lv_font_get_glyph_width(DIAL_FONT, c, 0) : 0;
+}
+
+static void dial_layout_cells(const char* text, int n)
+{
+    // Keep the string centred; only happens when its shape changes
+    int32_t x = 0;
+    for (int i = 0; i < n; i++) x += cell_width(text[i]);
+    x = -x / 2;
+
+    for (int i = 0; i < DIAL_CELLS; i++) {
+        if (i >= n) {
+            lv_obj_add_flag(dial_cells[i], LV_OBJ_FLAG_HIDDEN);
+            continue;
+        }
+        int32_t w = cell_width(text[i]);
+        lv_obj_remove_flag(dial_cells[i], LV_OBJ_FLAG_HIDDEN);
+        if (!cells_cached) lv_obj_set_width(dial_cells[i], w);
+        lv_obj_align(dial_cells[i], LV_ALIGN_CENTER, x + w / 2, cell_y);
+        x += w;
+    }
+    shown_len = n;
+}
+
+#if DIAL_RING_SPRITE
+static int dial_units(int value)
+{
+    if (value > dial_max) value = dial_max;
+    return value * DIAL_RING_UNITS / dial_max;
+}
+
+// Invalidate the bounding box of sweep units [u0, u1)
+static void dial_ring_invalidate(int u0, int u1)
+{
+    int32_t x1 = DIAL_RING_SIZE, y1 = DIAL_RING_SIZE, x2 = -1, y2 = -1;
+    for (int u = u0; u < u1; u++) {
+        const DialRingBox& b = dial_ring_unit_box[u];
+        if (b.x1 < x1) x1 = b.x1;
+        if (b.x2 > x2) x2 = b.x2;
+        if (b.y1 < y1) y1 = b.y1;
+        if (b.y2 > y2) y2 = b.y2;
+    }
+    if (x1 > x2) return;
+
+    lv_area_t c;
+    lv_obj_get_coords(dial_arc, &c);
+    lv_area_t a = { c.x1 + x1, c.y1 + y1, c.x1 + x2, c.y1 + y2 };
+    lv_obj_invalidate_area(dial_arc, &a);
+}
+
+static void dial_ring_draw_cb(lv_event_t* e)
+{
+    lv_layer_t* layer = lv_event_get_layer(e);
+    lv_area_t c;
+    lv_obj_get_coords(dial_arc, &c);
+    int32_t ix = c.x1 + DIAL_RING_IMG_X;
+    int32_t iy = c.y1 + DIAL_RING_IMG_Y;
+    lv_area_t img = { ix, iy, ix + DIAL_RING_IMG_W - 1, iy + DIAL_RING_IMG_H - 1 };
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = &ring_img_bg;
+    lv_draw_image(layer, &dsc, &img);
+
+    // Green over it: the generator's rectangles for this value, each a
+    // window into the green image at its full stride. LVGL clips them to
+    // the area being redrawn and only reads the descriptors once it
+    // renders, so every one needs its own.
+    static lv_image_dsc_t part[DIAL_RING_MAX_RECTS];
+    uint32_t n = 0;
+    for (uint32_t i = dial_ring_rect_first[ring_units]; i < dial_ring_rect_first[ring_units + 1]; i++) {
+        const DialRingBox& r = dial_ring_rects[i];
+        lv_image_dsc_t& p = part[n++];
+        p = ring_img_ind;
+        p.header.w = r.x2 - r.x1 + 1;
+        p.header.h = r.y2 - r.y1 + 1;
+        p.data = (const uint8_t*)((const uint16_t*)ring_img_ind.data + r.y1 * DIAL_RING_IMG_W + r.x1);
+        p.data_size = ((p.header.h - 1) * DIAL_RING_IMG_W + p.header.w) * sizeof(uint16_t);
+
+        lv_area_t a = { ix + r.x1, iy + r.y1, ix + r.x2, iy + r.y2 };
+        dsc.src = &p;
+        lv_draw_image(layer, &dsc, &a);
+    }
+}
+
+static void dial_ring_image(lv_image_dsc_t* img, const uint16_t* px, lv_color_format_t cf)
+{
+    memset(img, 0, sizeof(*img));
+    img->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img->header.cf = cf;
+    img->header.w = DIAL_RING_IMG_W;
+    img->header.h = DIAL_RING_IMG_H;
+    img->header.stride = DIAL_RING_IMG_W * sizeof(uint16_t);
+    img->data_size = DIAL_RING_IMG_W * DIAL_RING_IMG_H * sizeof(uint16_t);
+    img->data = (const uint8_t*)px;
+}
+#endif
+
+static void dial_update_arc(int prev, int value)
+{
+#if DIAL_RING_SPRITE
+    int u_prev = dial_units(prev);
+    ring_units = dial_units(value);
+    if (ring_units > u_prev)
+        dial_ring_invalidate(u_prev, ring_units);
+    else
+        dial_ring_invalidate(ring_units, u_prev);
+#else
+    // lv_arc only invalidates the sector between old and new angle
+    (void)prev;
+    lv_arc_set_value(dial_arc, value);
+#endif
+}
+
+static void dial_update_cells(const char* text)
+{
+    int n = 0;
+    while (n < DIAL_CELLS && text[n]) n++;
+
+    // Same length and the sign and point in the same places: no re-layout
+    bool reshape = n != shown_len;
+    for (int i = 0; i < n && !reshape; i++)
+        reshape = cell_width(text[i]) != cell_width(shown_text[i]);
+    if (reshape) dial_layout_cells(text, n);
+
+    for (int i = 0; i < n; i++) {
+        if (text[i] == shown_text[i]) continue;
+        if (cells_cached)
+            lv_image_set_src(dial_cells[i], digit_cache_glyph(text[i]));   // plain blit
+        else
+            lv_label_set_text_static(dial_cells[i], cell_text(text[i]));
+        shown_text[i] = text[i];
+    }
+}
+
+static const char* dial_index_text(int value)
+{
+    static char buf[DIAL_DIGITS + 1];
+    char* p = buf + DIAL_DIGITS;
+    do {
+        *--p = '0' + value % 10;
+        value /= 10;
+    } while (value && p > buf);
+    return p;
+}
+
+// dB strings are rebuilt once per scale change, after the blob's
+// fields have all landed (they publish one by one)
+static struct { int zero, step, max; } db_built = { -1, -1, -1 };
+static bool db_rebuild_pending;
+
+static void dial_db_rebuild(void*)
+{
+    db_rebuild_pending = false;
+    db_built.zero = params_get(&param_master_steps);
+    db_built.step = params_get(&param_step_db10);
+    db_built.max  = params_get(&param_master_max);
+    db_table_build(db_built.zero, db_built.step, db_built.max);
+
+    // Same pointer, new contents: the cells compare by character
+    if (dial_value >= 0) dial_update_cells(db_table_get(dial_value));
+}
+
+static void dial_update_readout(int value)
+{
+    // No formatting, no alloc: both strings are ready-made
+    dial_update_cells(DIAL_READOUT_DB ? db_table_get(value) : dial_index_text(value));
+}
+
+// ---------------- Store Observers ----------------
+static void dial_show(int value)
+{
+    if (value == dial_value) return;
+    int prev = dial_value;
+    dial_value = value;
+    lat_trace_mark(LAT_MODEL);
+
+    if (prev >= 0) {
+        // Close out the previous detent, including what its refresh added
+        inv_stats.detents++;
+        inv_stats.last_px = inv_px_acc;
+        inv_px_acc = 0;
+    }
+
+    dial_update_arc(prev < 0 ? 0 : prev, value);
+    dial_update_readout(value);
+
+    BLOG(DIAL_VALUE, value);
 }
 
+static void dial_index_observer(lv_observer_t*, lv_subject_t* subject)
+{
+    dial_show(lv_subject_get_int(subject));
+}
+
+static void dial_scale_observer(lv_observer_t*, lv_subject_t*)
+{
+    if (!DIAL_READOUT_DB || db_rebuild_pending) return;
+    if (db_built.zero == params_get(&param_master_steps) &&
+        db_built.step == params_get(&param_step_db10) &&
+        db_built.max  == params_get(&param_master_max))
+        return;
+
+    db_rebuild_pending = true;
+    lv_async_call(dial_db_rebuild, NULL);
+}
+
+static void dial_max_observer(lv_observer_t* observer, lv_subject_t* subject)
+{
+    dial_scale_observer(observer, subject);
+
+    int max = lv_subject_get_int(subject);
+    if (max <= 0 || max == dial_max) return;
+    dial_max = max;
+
+    // New scale: the indicator end moves even though the index did not
+#if DIAL_RING_SPRITE
+    ring_units = dial_value > 0 ? dial_units(dial_value) : 0;
+    lv_obj_invalidate(dial_arc);
+#else
+    lv_arc_set_range(dial_arc, 0, max);
+#endif
+}
+
+// Ring and glyphs in the display's byte order, so drawing them is a
+// copy. The flash ring is compiled in the build's order; only the host
+// benches change a display's format at runtime, and they get a swapped
+// copy of it on the heap.
+static void dial_match_color_format(lv_obj_t* parent)
+{
+    lv_color_format_t cf = lv_display_get_color_format(lv_obj_get_display(parent));
+
+#if DIAL_RING_SPRITE
+    const uint32_t n = DIAL_RING_IMG_W * DIAL_RING_IMG_H;
+    const uint16_t* bg = dial_ring_bg;
+    const uint16_t* ind = dial_ring_ind;
+    lv_color_format_t ring_cf = DIAL_RING_CF;
+    uint16_t* old = ring_px_swapped;
+    ring_px_swapped = nullptr;
+
+    if (cf != DIAL_RING_CF) {
+        ring_px_swapped = (uint16_t*)malloc(2 * n * sizeof(uint16_t));
+        if (ring_px_swapped) {      // else LVGL converts on every draw
+            for (uint32_t i = 0; i < n; i++) {
+                ring_px_swapped[i]     = (uint16_t)(dial_ring_bg[i] << 8 | dial_ring_bg[i] >> 8);
+                ring_px_swapped[n + i] = (uint16_t)(dial_ring_ind[i] << 8 | dial_ring_ind[i] >> 8);
+            }
+            bg = ring_px_swapped;
+            ind = ring_px_swapped + n;
+            ring_cf = cf;
+        }
+    }
+    dial_ring_image(&ring_img_bg, bg, ring_cf);
+    dial_ring_image(&ring_img_ind, ind, ring_cf);
+    free(old);
+#endif
+
+#if DIAL_GLYPH_CACHE
+    if (cells_cached) digit_cache_build(parent, DIAL_FONT, DIAL_FONT_COLOR, DIAL_BG_COLOR);
+#endif
+    (void)cf;
+}
+
+static void dial_color_format_cb(lv_event_t* e)
+{
+    lv_obj_t* parent = (lv_obj_t*)lv_event_get_user_data(e);
+    dial_match_color_format(parent);
+    lv_obj_invalidate(parent);
+}
 
 // ---------------- Public API Implementations ----------------
 void master_dial_create(lv_obj_t* parent)
 {
+    params_init();
+
     // ----- DIAL ----
     lv_obj_set_style_bg_color(parent, DIAL_BG_COLOR, 0);
 
     // ----- ARC -----
+#if DIAL_RING_SPRITE
+    // Pre-rendered ring: gray background everywhere, green up to the value
+    ring_units = 0;
+
+    dial_arc = lv_obj_create(parent);
+    lv_obj_remove_style_all(dial_arc);
+    lv_obj_remove_flag(dial_arc, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_size(dial_arc, DIAL_RING_SIZE, DIAL_RING_SIZE);
+    lv_obj_center(dial_arc);
+    lv_obj_add_event_cb(dial_arc, dial_ring_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+#else
     dial_arc = lv_arc_create(parent);
     lv_obj_set_size(dial_arc, 220, 220);
     lv_obj_center(dial_arc);
@@ -44,15 +377,54 @@ void master_dial_create(lv_obj_t* parent)
     lv_arc_set_bg_end_angle(dial_arc, 35);
     lv_arc_set_start_angle(dial_arc, 145);
     lv_arc_set_end_angle(dial_arc, 35);
+    lv_arc_set_range(dial_arc, 0, dial_max);
 
     lv_obj_set_style_arc_color(dial_arc, DIAL_ARC_MAIN_COLOR, LV_PART_MAIN);
     lv_obj_set_style_arc_color(dial_arc, DIAL_ARC_IND_COLOR, LV_PART_INDICATOR);
+#endif
+
+    // ----- CENTER READOUT -----
+    const lv_font_t* font = DIAL_FONT;
+    cell_y = DIAL_READOUT_DB ? -10 : 0;
+#if DIAL_GLYPH_CACHE
+    cells_cached = digit_cache_build(parent, font, DIAL_FONT_COLOR, DIAL_BG_COLOR);
+#else
+    cells_cached = false;
+#endif
+    dial_match_color_format(parent);
 
-    // ----- CENTER LABEL -----
-    dial_label = lv_label_create(parent);
-    lv_obj_center(dial_label);
-    lv_obj_set_style_text_font(dial_label, &lv_font_montserrat_48, 0);
-    lv_obj_set_style_text_color(dial_label, DIAL_FONT_COLOR, 0);
+    digit_cell_w = 0;
+    for (char c = '0'; c <= '9'; c++) {
+        int32_t w = lv_font_get_glyph_width(font, c, 0);
+        if (w > digit_cell_w) digit_cell_w = w;
+    }
+
+    for (int i = 0; i < DIAL_CELLS; i++) {
+        if (cells_cached) {
+            dial_cells[i] = lv_image_create(parent);
+        } else {
+            dial_cells[i] = lv_label_create(parent);
+            lv_obj_set_size(dial_cells[i], digit_cell_w, lv_font_get_line_height(font));
+            lv_obj_set_style_text_font(dial_cells[i], font, 0);
+            lv_obj_set_style_text_color(dial_cells[i], DIAL_FONT_COLOR, 0);
+            lv_obj_set_style_text_align(dial_cells[i], LV_TEXT_ALIGN_CENTER, 0);
+        }
+        lv_obj_add_flag(dial_cells[i], LV_OBJ_FLAG_HIDDEN);
+        shown_text[i] = 0;
+    }
+    shown_len = 0;
+
+    if (DIAL_READOUT_DB) {
+        // "dB" under the number, where the 48px line box ends
+        dial_db_unit = lv_label_create(parent);
+        lv_obj_set_style_text_font(dial_db_unit, &lv_font_montserrat_20, 0);
+        lv_obj_set_style_text_color(dial_db_unit, DIAL_FONT_COLOR, 0);
+        lv_label_set_text_static(dial_db_unit, "dB");
+        lv_obj_align(dial_db_unit, LV_ALIGN_CENTER, 0,
+                     cell_y + (lv_font_get_line_height(font) + lv_font_get_line_height(&lv_font_montserrat_20)) / 2);
+
+        dial_db_rebuild(NULL);      // default scale until the blob arrives
+    }
 
     // ----- FUNCTION LABEL -----
     dial_function = lv_label_create(parent);
@@ -61,29 +433,32 @@ void master_dial_create(lv_obj_t* parent)
     lv_label_set_text(dial_function, "MASTER\nVOLUME");
     lv_obj_set_style_text_color(dial_function, DIAL_FONT_COLOR, 0);
 
-    // Initial state
-    lv_arc_set_value(dial_arc, dial_value);
-    dial_update_label(dial_value);
+    // Bind to the store; observers fire once right away with the current values
+    lv_subject_add_observer_obj(&param_master_max, dial_max_observer, dial_arc, NULL);
+    lv_subject_add_observer_obj(&param_master_steps, dial_scale_observer, dial_arc, NULL);
+    lv_subject_add_observer_obj(&param_step_db10, dial_scale_observer, dial_arc, NULL);
+    lv_subject_add_observer_obj(&param_master_index, dial_index_observer, dial_arc, NULL);
+
+    lv_display_add_event_cb(lv_obj_get_display(parent), dial_inv_event_cb,
+                            LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(lv_obj_get_display(parent), dial_color_format_cb,
+                            LV_EVENT_COLOR_FORMAT_CHANGED, parent);
 }
 
 void master_dial_set_value(int delta)
 {
-    // UI optimism: move visually immediately
-    dial_value += delta;
-    if (dial_value < 0)   dial_value = 0;
-    if (dial_value > 100) dial_value = 100;
-
-    lv_arc_set_value(dial_arc, dial_value);
-    dial_update_label(dial_value);
-
-    // Protocol intent
+    // Intent only: the protocol clamps and publishes param_master_index,
+    // and the observer below moves the dial if the value really changed
     helix_volume_delta(delta);
-
-    Serial.printf("Master Dial: %d\n", dial_value);
-
 }
 
 int master_dial_get_value()
 {
     return dial_value;
 }
+
+const DialInvStats& master_dial_inv_stats()
+{
+    inv_stats.pending_px = inv_px_acc;
+    return inv_stats;
+}
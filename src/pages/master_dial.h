@@ -1,10 +1,58 @@
 #pragma once
 #include <lvgl.h>
 
+#include "db_table.h"
+
+#define DIAL_DIGITS 3    // master index, 0..2*steps (≤ 254)
+
+// 1: centre characters are blits from a pre-blended RGB565 cache (digit_cache.h)
+// 0: centre characters are Montserrat 48 labels rasterized on every draw
+#ifndef DIAL_GLYPH_CACHE
+#define DIAL_GLYPH_CACHE 1
+#endif
+
+// 1: the arc is drawn from the pre-rendered ring images in flash
+//    (dial_ring_sprite.c): gray ring, then the generator's rectangles of
+//    the green one for the value. A detent invalidates the sector it
+//    changed.
+// 0: the arc is an lv_arc rendered with AA circle masks
+#ifndef DIAL_RING_SPRITE
+#define DIAL_RING_SPRITE 1
+#endif
+
+// 1: centre shows master dB ("-12.5") from db_table.h strings, with a
+//    small "dB" unit below
+// 0: centre shows the raw master index
+// Either way it is one cell per character, so a detent redraws only the
+// characters that changed.
+#ifndef DIAL_READOUT_DB
+#define DIAL_READOUT_DB 1
+#endif
+
+#if DIAL_READOUT_DB
+#define DIAL_CELLS (DB_TABLE_STR_LEN - 1)
+#else
+#define DIAL_CELLS DIAL_DIGITS
+#endif
+
+// Pixels invalidated on the display while the dial updates
+struct DialInvStats {
+    uint32_t detents;       // value changes
+    uint64_t total_px;
+    uint32_t last_px;       // previous detent, including its refresh/layout
+    uint32_t pending_px;    // current detent so far
+};
+
 // Public API for this page:
 
+// The dial observes param_master_index / param_master_max (model/params.h)
 void master_dial_create(lv_obj_t* parent);
+
+// Encoder detents: forwarded to helix_volume_delta(); the dial follows
+// the store, so it only moves once the protocol accepted the change
 void master_dial_set_value(int delta);
 
-// Optional getter, in case you want the dial value externally
+// Index currently on screen
 int master_dial_get_value();
+
+const DialInvStats& master_dial_inv_stats();
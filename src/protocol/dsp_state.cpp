@@ -0,0 +1,122 @@
+#include "dsp_state.h"
+
+// ---------------- Blob layout ----------------
+// Payload offsets (payload[0] is the device address, [1..2] group/id like
+// every Helix frame). Multi-byte fields are little endian.
+//
+// Provisional map: confirm each offset against a captured blob from the
+// DSP before relying on it. The decoder itself is layout-agnostic.
+struct BlobField {
+    DspField field;
+    uint8_t  offset;
+    uint8_t  width;         // 1 or 2
+};
+
+static const BlobField dsp_blob_layout[] = {
+    { DSP_FW_VERSION,   0x03, 2 },
+    { DSP_PRESET,       0x05, 1 },
+    { DSP_SOURCE,       0x06, 1 },
+    { DSP_MUTE,         0x07, 1 },
+    { DSP_MASTER_INDEX, 0x08, 1 },
+    { DSP_MASTER_STEPS, 0x09, 1 },
+    { DSP_STEP_DB10,    0x0A, 1 },
+};
+
+// Byte offset → (field, byte within field); 0xFF = not mapped.
+// Built once so the per-byte cost is a single table load.
+struct ByteSlot {
+    uint8_t field;
+    uint8_t shift;          // 0 or 8
+};
+
+static ByteSlot slot_of[HELIX_LEN_BLOB];
+
+static void build_slots()
+{
+    for (ByteSlot& s : slot_of) s = { 0xFF, 0 };
+    for (const BlobField& f : dsp_blob_layout)
+        for (uint8_t b = 0; b < f.width && f.offset + b < HELIX_LEN_BLOB; b++)
+            slot_of[f.offset + b] = { f.field, (uint8_t)(8 * b) };
+}
+
+void dsp_blob_encode(const DspState& s, uint8_t* payload)
+{
+    for (int i = 0; i < HELIX_LEN_BLOB; i++) payload[i] = 0;
+    payload[0] = 0x01;
+    for (const BlobField& f : dsp_blob_layout)
+        for (uint8_t b = 0; b < f.width; b++)
+            payload[f.offset + b] = (uint8_t)(s.value[f.field] >> (8 * b));
+}
+
+// ---------------- Decoder ----------------
+void DspBlobDecoder::begin()
+{
+    build_slots();
+    state_ = {};
+    staged_valid_ = 0;
+    active_ = false;
+    n_subs_ = 0;
+    stats_ = {};
+    hooks_ = {
+        [](uint8_t len, void* ctx) { return ((DspBlobDecoder*)ctx)->start(len); },
+        [](uint32_t off, const uint8_t* p, uint32_t n, void* ctx) { ((DspBlobDecoder*)ctx)->bytes(off, p, n); },
+        [](bool ok, void* ctx) { ((DspBlobDecoder*)ctx)->end(ok); },
+        this,
+    };
+}
+
+bool DspBlobDecoder::subscribe(DspField field, dsp_field_cb cb, void* ctx)
+{
+    if (n_subs_ >= DSP_MAX_SUBSCRIBERS) return false;
+    subs_[n_subs_++] = { cb, ctx, field };
+    return true;
+}
+
+bool DspBlobDecoder::start(uint8_t len)
+{
+    if (len != HELIX_LEN_BLOB) return false;
+    // Fields are OR-assembled byte by byte
+    for (int f = 0; f < DSP_FIELD_COUNT; f++) staged_[f] = 0;
+    staged_valid_ = 0;
+    active_ = true;
+    stats_.started++;
+    return true;
+}
+
+void DspBlobDecoder::bytes(uint32_t offset, const uint8_t* p, uint32_t n)
+{
+    if (!active_) return;
+    for (uint32_t i = 0; i < n && offset + i < HELIX_LEN_BLOB; i++) {
+        ByteSlot s = slot_of[offset + i];
+        if (s.field == 0xFF) continue;
+        staged_[s.field] |= (uint16_t)(p[i] << s.shift);
+        staged_valid_ |= 1u << s.field;
+    }
+}
+
+void DspBlobDecoder::end(bool ok)
+{
+    if (!active_) return;
+    active_ = false;
+    if (!ok) {
+        stats_.aborted++;
+        return;
+    }
+
+    uint32_t changed = 0;
+    for (int f = 0; f < DSP_FIELD_COUNT; f++) {
+        if (!(staged_valid_ & (1u << f))) continue;
+        bool first = !state_.has((DspField)f);
+        if (first || state_.value[f] != staged_[f]) changed |= 1u << f;
+        state_.value[f] = staged_[f];
+    }
+    state_.valid |= staged_valid_;
+    state_.blobs++;
+    stats_.committed++;
+
+    for (uint8_t i = 0; i < n_subs_; i++) {
+        const Sub& s = subs_[i];
+        if (changed & (1u << s.field))
+            s.cb(s.field, state_.value[s.field], s.ctx);
+    }
+}
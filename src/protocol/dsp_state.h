@@ -0,0 +1,88 @@
+#pragma once
+#include <stdint.h>
+#include "helix_parser.h"
+
+// ---------------- DSP configuration model ----------------
+// The DSP answers the handshake with one 0x50-byte configuration blob
+// (the frame whose ~len byte is 0xAF). DspBlobDecoder decodes it as the
+// payload streams through HelixParser, straight into a fixed DspState:
+// no copy of the blob is kept, only the few bytes each field needs.
+//
+// Fields land in a staging copy; end(ok) publishes them only if the
+// frame checksum passed, then notifies subscribers of fields that changed.
+//
+// Where each field sits in the payload is the dsp_blob_layout[] table in
+// dsp_state.cpp, the single place to touch when the map is refined.
+
+enum DspField : uint8_t {
+    DSP_MASTER_INDEX,       // current master volume step, 0..2*steps
+    DSP_MASTER_STEPS,       // steps from minimum to 0 dB
+    DSP_STEP_DB10,          // dB per step, tenths
+    DSP_MUTE,
+    DSP_SOURCE,             // active input
+    DSP_PRESET,             // active preset slot
+    DSP_FW_VERSION,         // major << 8 | minor
+    DSP_FIELD_COUNT
+};
+
+struct DspState {
+    uint16_t value[DSP_FIELD_COUNT];
+    uint32_t valid;         // bit per field: present in a committed blob
+    uint16_t blobs;         // committed blobs
+
+    uint16_t get(DspField f) const { return value[f]; }
+    bool has(DspField f) const { return valid & (1u << f); }
+};
+
+typedef void (*dsp_field_cb)(DspField field, uint16_t value, void* ctx);
+
+#ifndef DSP_MAX_SUBSCRIBERS
+#define DSP_MAX_SUBSCRIBERS 8
+#endif
+
+struct DspBlobStats {
+    uint32_t started;
+    uint32_t committed;
+    uint32_t aborted;       // checksum failed or frame cut short
+};
+
+// Inverse of the decoder, from the same layout table: writes the
+// HELIX_LEN_BLOB payload for `s` (device address 0x01, unmapped bytes 0).
+// For DSP stand-ins and tests.
+void dsp_blob_encode(const DspState& s, uint8_t* payload);
+
+class DspBlobDecoder {
+public:
+    void begin();
+
+    // Parser hooks for HELIX_LEN_BLOB frames (HelixParser::setStream)
+    const HelixStreamHooks* hooks() const { return &hooks_; }
+
+    // Called once per changed field after each committed blob, and once
+    // per field on the first one. Returns false when the table is full.
+    bool subscribe(DspField field, dsp_field_cb cb, void* ctx = nullptr);
+
+    const DspState& state() const { return state_; }
+    const DspBlobStats& stats() const { return stats_; }
+
+    // Direct feed, same contract as the hooks (used by the host bench)
+    bool start(uint8_t len);
+    void bytes(uint32_t offset, const uint8_t* p, uint32_t n);
+    void end(bool ok);
+
+private:
+    struct Sub {
+        dsp_field_cb cb;
+        void* ctx;
+        DspField field;
+    };
+
+    DspState state_ = {};
+    uint16_t staged_[DSP_FIELD_COUNT] = {};
+    uint32_t staged_valid_ = 0;
+    bool active_ = false;
+    Sub subs_[DSP_MAX_SUBSCRIBERS] = {};
+    uint8_t n_subs_ = 0;
+    DspBlobStats stats_ = {};
+    HelixStreamHooks hooks_ = {};
+};
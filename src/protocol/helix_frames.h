@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+
+// ---------------- Helix wire framing ----------------
+// Every frame on the DSP link looks like the handshake packets:
+//
+//   0x42  len  ~len  payload[len]  checksum
+//
+// checksum = (len + ~len + sum(payload)) & 0xFF, i.e. the additive sum
+// of every byte after the sync byte. HS0 = 42 03 FC | 01 2A 00 | 2A.
+//
+// Payload layout: [0] device address, [1] group, [2] id, [3..] data.
+
+#define HELIX_SYNC          0x42
+#define HELIX_HEADER_LEN    3       // sync, len, ~len
+#define HELIX_OVERHEAD      4       // header + checksum
+#define HELIX_MAX_PAYLOAD   255
+#define HELIX_MAX_FRAME     (HELIX_MAX_PAYLOAD + HELIX_OVERHEAD)
+
+// DSP → controller frame types, keyed by payload length. The old
+// byte-dump "markers" were the ~len bytes of these two frames:
+// 0xFB = ~0x04 (ready/ack) and 0xAF = ~0x50 (configuration blob).
+#define HELIX_LEN_READY     0x04
+#define HELIX_LEN_BLOB      0x50
+
+static inline uint8_t helix_checksum(const uint8_t* frame, uint8_t len)
+{
+    uint8_t sum = 0;
+    for (int i = 1; i < HELIX_HEADER_LEN + len; i++)
+        sum += frame[i];
+    return sum;
+}
@@ -0,0 +1,127 @@
+#include "helix_handshake.h"
+#include "helix_packets.h"
+#include "log/binlog.h"
+
+
+void HelixHandshake::begin(HelixTransport& out, uint32_t now_ms)
+{
+    out_ = &out;
+    ready_ = false;
+    stats_ = {};
+    t_begin_ms_ = t_sync_ms_ = now_ms;
+    BLOG(HELIX_HS_START);
+    enter(SEND_HS0);
+    poll(now_ms);
+}
+
+void HelixHandshake::enter(Stage s)
+{
+    // New stage: back to the first timeout
+    stage_ = s;
+    tries_ = 0;
+    timeout_ms_ = HELIX_HS_TIMEOUT_MS;
+}
+
+bool HelixHandshake::send(const uint8_t* pkt, size_t len)
+{
+    if (out_->availableForWrite() < (int)len) return false;
+    out_->write(pkt, len);
+    stats_.packets_sent++;
+    tries_++;
+    return true;
+}
+
+void HelixHandshake::poll(uint32_t now_ms)
+{
+    if (!out_) return;
+
+    switch (stage_) {
+    case SEND_HS0:
+        if (send(HELIX_HS0.data(), HELIX_HS0.size)) {
+            deadline_ms_ = now_ms + timeout_ms_;
+            stage_ = WAIT_ACK;
+        }
+        break;
+
+    case SEND_HS1:
+        if (send(HELIX_HS1.data(), HELIX_HS1.size)) {
+            deadline_ms_ = now_ms + timeout_ms_;
+            stage_ = WAIT_BLOB;
+        }
+        break;
+
+    case WAIT_ACK:
+    case WAIT_BLOB:
+        if ((int32_t)(now_ms - deadline_ms_) < 0) break;
+
+        stats_.timeouts++;
+        BLOG(HELIX_HS_TIMEOUT, stage_ == WAIT_ACK ? 0 : 1, tries_, timeout_ms_);
+        if (timeout_ms_ < HELIX_HS_TIMEOUT_MAX_MS) {
+            timeout_ms_ *= 2;
+            if (timeout_ms_ > HELIX_HS_TIMEOUT_MAX_MS) timeout_ms_ = HELIX_HS_TIMEOUT_MAX_MS;
+        }
+
+        if (stage_ == WAIT_ACK) {
+            stage_ = SEND_HS0;          // keep backing off until the DSP shows up
+        } else if (tries_ < HELIX_HS_STAGE_TRIES) {
+            stage_ = SEND_HS1;
+        } else {
+            stats_.restarts++;
+            enter(SEND_HS0);
+        }
+        poll(now_ms);
+        break;
+
+    case READY:
+        break;
+    }
+}
+
+void HelixHandshake::onReadyFrame(uint32_t now_ms)
+{
+    switch (stage_) {
+    case READY:
+        // DSP restarted behind our back: refresh its configuration
+        t_sync_ms_ = now_ms;
+        // fall through
+    case SEND_HS0:
+    case WAIT_ACK:
+        enter(SEND_HS1);
+        poll(now_ms);
+        break;
+    default:
+        break;                          // duplicate ack while fetching the blob
+    }
+}
+
+void HelixHandshake::onBlob(uint32_t now_ms)
+{
+    if (stage_ == READY) return;        // unsolicited refresh; the model took it already
+
+    stage_ = READY;
+    stats_.handshakes++;
+    stats_.last_sync_ms = now_ms - t_sync_ms_;
+    if (!ready_) {
+        ready_ = true;
+        stats_.time_to_ready_ms = now_ms - t_begin_ms_;
+        BLOG(HELIX_READY, stats_.time_to_ready_ms, stats_.packets_sent, stats_.timeouts);
+    } else {
+        BLOG(HELIX_RESYNC, stats_.last_sync_ms);
+    }
+}
+
+uint32_t HelixHandshake::next_due_ms(uint32_t now_ms) const
+{
+    switch (stage_) {
+    case SEND_HS0:
+    case SEND_HS1:
+        return 1;                       // waiting for FIFO room
+    case WAIT_ACK:
+    case WAIT_BLOB: {
+        int32_t left = (int32_t)(deadline_ms_ - now_ms);
+        return left > 0 ? (uint32_t)left : 0;
+    }
+    default:
+        return UINT32_MAX;
+    }
+}
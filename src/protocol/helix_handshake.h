@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+#include "helix_transport.h"
+
+// ---------------- Link handshake ----------------
+// HS0 asks the DSP to announce itself (it answers with the 4-byte ready
+// frame), HS1 asks for the configuration blob. The link is only "ready"
+// once both stages completed, in order:
+//
+//   SEND_HS0 → WAIT_ACK ─ready frame→ SEND_HS1 → WAIT_BLOB ─blob→ READY
+//
+// Each wait has a deadline. A timeout resends the same stage with the
+// timeout doubled (capped at HELIX_HS_TIMEOUT_MAX_MS); after
+// HELIX_HS_STAGE_TRIES misses on HS1 it starts over from HS0. Nothing
+// blocks: poll() only writes when the UART FIFO has room, so a DSP
+// powered up after the controller is picked up on the next retry.
+// A ready frame after READY means the DSP restarted: the blob is
+// fetched again while the link stays usable.
+
+#ifndef HELIX_HS_TIMEOUT_MS
+#define HELIX_HS_TIMEOUT_MS     100     // first wait per stage
+#endif
+
+#ifndef HELIX_HS_TIMEOUT_MAX_MS
+#define HELIX_HS_TIMEOUT_MAX_MS 3200    // backoff cap
+#endif
+
+#ifndef HELIX_HS_STAGE_TRIES
+#define HELIX_HS_STAGE_TRIES    4       // HS1 resends before restarting at HS0
+#endif
+
+struct HelixLinkStats {
+    uint32_t handshakes;        // completed (incl. re-syncs after DSP restart)
+    uint32_t packets_sent;      // HS0 + HS1 writes
+    uint32_t timeouts;
+    uint32_t restarts;          // HS1 gave up, back to HS0
+    uint32_t time_to_ready_ms;  // begin() → first READY; 0 until then
+    uint32_t last_sync_ms;      // duration of the most recent handshake
+};
+
+class HelixHandshake {
+public:
+    enum Stage : uint8_t { SEND_HS0, WAIT_ACK, SEND_HS1, WAIT_BLOB, READY };
+
+    void begin(HelixTransport& out, uint32_t now_ms);
+    void poll(uint32_t now_ms);
+
+    // Frame events from the RX dispatcher
+    void onReadyFrame(uint32_t now_ms);
+    void onBlob(uint32_t now_ms);
+
+    bool ready() const { return ready_; }
+    Stage stage() const { return stage_; }
+
+    // ms until poll() has a deadline to check (UINT32_MAX = none)
+    uint32_t next_due_ms(uint32_t now_ms) const;
+
+    const HelixLinkStats& stats() const { return stats_; }
+
+private:
+    void enter(Stage s);
+    bool send(const uint8_t* pkt, size_t len);
+
+    HelixTransport* out_ = nullptr;
+    Stage stage_ = SEND_HS0;
+    bool ready_ = false;
+    uint8_t tries_ = 0;             // sends of the current stage
+    uint32_t timeout_ms_ = HELIX_HS_TIMEOUT_MS;
+    uint32_t deadline_ms_ = 0;
+    uint32_t t_begin_ms_ = 0;
+    uint32_t t_sync_ms_ = 0;        // current handshake (or re-sync) started here
+    HelixLinkStats stats_ = {};
+};
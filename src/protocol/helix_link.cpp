@@ -0,0 +1,187 @@
+#include "helix_link.h"
+#include "log/binlog.h"
+#include "model/params.h"
+
+// Master volume: group 0x2A, id 0x04
+#define MASTER_GROUP 0x2A
+#define MASTER_ID    0x04
+
+static_assert((HELIX_RX_RING_SIZE & (HELIX_RX_RING_SIZE - 1)) == 0, "HELIX_RX_RING_SIZE must be a power of two");
+static_assert(HELIX_RX_RING_SIZE >= HELIX_MAX_FRAME, "HELIX_RX_RING_SIZE must hold a whole frame");
+
+HelixLink::HelixLink()
+    : rx_ring_(rx_buf_, sizeof(rx_buf_))
+{
+}
+
+// ---------------- Frame Handlers ----------------
+const HelixLink::FrameHandler HelixLink::frame_handlers_[] = {
+    { HELIX_LEN_READY, &HelixLink::on_ready },
+    { HELIX_LEN_BLOB,  &HelixLink::on_blob  },
+};
+
+void HelixLink::on_frame(const HelixFrame& f, void* ctx)
+{
+    HelixLink* link = (HelixLink*)ctx;
+    for (const FrameHandler& h : frame_handlers_) {
+        if (h.len == f.len) {
+            (link->*h.fn)(f);
+            return;
+        }
+    }
+}
+
+void HelixLink::on_ready(const HelixFrame&)
+{
+    hs_.onReadyFrame(millis());
+}
+
+void HelixLink::on_blob(const HelixFrame& f)
+{
+    // DspBlobDecoder has already committed it by the time this runs
+    BLOG(HELIX_BLOB, f.len);
+    hs_.onBlob(millis());
+}
+
+// Keeps the link's copy and, for the publishing link, the shared store
+static void set_master(bool publish, int32_t* field, lv_subject_t* subject, int32_t value)
+{
+    *field = value;
+    if (publish) params_set(subject, value);
+}
+
+void HelixLink::on_master_field(DspField field, uint16_t value, void* ctx)
+{
+    HelixLink* link = (HelixLink*)ctx;
+    HelixMaster& m = link->master_;
+    bool pub = link->publish_;
+
+    switch (field) {
+    case DSP_MASTER_STEPS:
+        if (value && value <= 127) {    // index goes on the wire as one byte
+            set_master(pub, &m.steps, &param_master_steps, value);
+            set_master(pub, &m.max, &param_master_max, 2 * value);
+            if (m.index > m.max) {      // index may have arrived first
+                link->tx_.assume(MASTER_GROUP, MASTER_ID, (uint8_t)m.max);
+                set_master(pub, &m.index, &param_master_index, m.max);
+            }
+        }
+        break;
+    case DSP_STEP_DB10:
+        if (value) set_master(pub, &m.step_db10, &param_step_db10, value);
+        break;
+    case DSP_MASTER_INDEX:
+        // Came from the DSP: publish for the UI, but never send it back.
+        // A corrupt or stale blob must not push the UI past its range.
+        if (value > m.max) value = m.max;
+        link->tx_.assume(MASTER_GROUP, MASTER_ID, (uint8_t)value);
+        set_master(pub, &m.index, &param_master_index, value);
+        break;
+    default:
+        break;
+    }
+}
+
+// ---------------- Link ----------------
+void HelixLink::begin(HelixTransport& io, bool publish)
+{
+    io_ = &io;
+    publish_ = publish;
+    if (publish_) params_init();
+
+    master_ = { PARAM_DEFAULT_STEPS, 2 * PARAM_DEFAULT_STEPS, PARAM_DEFAULT_STEPS, PARAM_DEFAULT_STEP_DB10 };
+    rx_path_ = {};
+    rx_path_.ring_size = rx_ring_.capacity();
+
+    rx_ring_.consume(rx_ring_.size());
+    rx_parser_.begin(on_frame, this);
+    blob_.begin();
+    rx_parser_.setStream(blob_.hooks());
+    blob_.subscribe(DSP_MASTER_STEPS, on_master_field, this);
+    blob_.subscribe(DSP_STEP_DB10,    on_master_field, this);
+    blob_.subscribe(DSP_MASTER_INDEX, on_master_field, this);
+    tx_.begin(io);
+    tx_.setTraced(publish_);        // the encoder's volume goes out on this link
+    hs_.begin(io, millis());
+}
+
+bool HelixLink::rx_pump()
+{
+    if (!io_) return true;
+    if (rx_pumping_.test_and_set(std::memory_order_acquire))
+        return true;                    // the other context is already at it
+
+    bool drained = true;
+    int avail;
+    while ((avail = io_->available()) > 0) {
+        uint32_t room;
+        uint8_t* p = rx_ring_.write_span(&room);
+        if (room == 0) {
+            rx_path_.ring_full++;
+            drained = false;
+            break;
+        }
+        size_t n = io_->read(p, room < (uint32_t)avail ? room : (uint32_t)avail);
+        if (n == 0) break;
+        rx_ring_.commit(n);
+        rx_path_.pumped += n;
+    }
+
+    uint32_t level = rx_ring_.size();
+    if (level > rx_path_.high_water) rx_path_.high_water = level;
+
+    rx_pumping_.clear(std::memory_order_release);
+    return drained;
+}
+
+void HelixLink::rx_error(HelixRxError e)
+{
+    switch (e) {
+    case HELIX_RX_FIFO_OVERFLOW: rx_path_.fifo_overflow++; break;
+    case HELIX_RX_DRIVER_FULL:   rx_path_.driver_full++;   break;
+    case HELIX_RX_LINE_ERROR:    rx_path_.line_errors++;   break;
+    }
+}
+
+void HelixLink::loop()
+{
+    if (!io_) return;
+
+    // A full ring always holds a whole frame, so parsing frees room
+    while (!rx_pump())
+        rx_parser_.poll(rx_ring_);
+    rx_parser_.poll(rx_ring_);
+
+    uint32_t now = millis();
+    hs_.poll(now);
+    tx_.poll(now);
+}
+
+uint32_t HelixLink::next_due_ms() const
+{
+    uint32_t now = millis();
+    uint32_t a = hs_.next_due_ms(now);
+    uint32_t b = tx_.next_due_ms(now);
+    return a < b ? a : b;
+}
+
+void HelixLink::volume_delta(int clicks)
+{
+    if (!hs_.ready()) {
+        BLOG(VOL_IGNORED);
+        return;
+    }
+
+    int32_t idx = master_.index + clicks;
+    if (idx < 0)           idx = 0;
+    if (idx > master_.max) idx = master_.max;
+
+    // Nothing to do at an end stop
+    if (idx == master_.index) return;
+
+    // Observers (the dial) run inside params_set for the publishing link
+    set_master(publish_, &master_.index, &param_master_index, idx);
+    tx_.set(MASTER_GROUP, MASTER_ID, (uint8_t)idx);
+
+    BLOG(VOL_SET, idx, (idx - master_.steps) * master_.step_db10);
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "helix_transport.h"
+#include "helix_parser.h"
+#include "helix_tx.h"
+#include "helix_handshake.h"
+#include "dsp_state.h"
+
+// ---------------- One DSP link ----------------
+// Everything needed to talk to one DSP over one HelixTransport: RX ring
+// and parser, blob decoder, handshake, TX scheduler, counters and the
+// link's view of the master volume. All of it is inline, so a link's
+// footprint is sizeof(HelixLink), fixed at compile time (no heap), and
+// links can be declared static, in arrays, or by the thousand on host.
+//
+// One link per controller may publish: it mirrors the master volume
+// into the shared store (model/params.h) the UI observes, and is the
+// one helix_protocol.h drives; its TX is also the one the latency
+// tracer follows. Other links keep their state to themselves.
+//
+// RX path: transport → rx ring → parser. rx_pump() is the ring's only
+// producer. Call it from the UART receive callback so bytes leave the
+// driver while loop() is busy rendering; loop() pumps too, in case no
+// callback is wired up, and a try-lock keeps the two from running at
+// once. With the ring full, bytes stay in the transport for the next
+// pump; they are only lost if the driver buffer or the hardware FIFO
+// overflows, which the UART error callback reports through rx_error().
+
+#ifndef HELIX_RX_RING_SIZE
+#define HELIX_RX_RING_SIZE 4096     // power of two; ~175 ms of line rate at 230400 baud
+#endif
+
+enum HelixRxError : uint8_t {
+    HELIX_RX_FIFO_OVERFLOW,     // hardware FIFO overran before the ISR drained it
+    HELIX_RX_DRIVER_FULL,       // driver buffer full, bytes dropped
+    HELIX_RX_LINE_ERROR,        // framing, parity or break
+};
+
+struct HelixRxPathStats {
+    uint32_t ring_size;
+    uint32_t high_water;        // most bytes ever waiting in the ring
+    uint32_t pumped;            // bytes moved driver → ring
+    uint32_t ring_full;         // pumps that left bytes in the driver
+    uint32_t fifo_overflow;
+    uint32_t driver_full;
+    uint32_t line_errors;
+};
+
+// The link's copy of the master volume scale and position
+struct HelixMaster {
+    int32_t index;
+    int32_t max;
+    int32_t steps;
+    int32_t step_db10;
+};
+
+class HelixLink {
+public:
+    HelixLink();
+    HelixLink(const HelixLink&) = delete;
+    HelixLink& operator=(const HelixLink&) = delete;
+
+    void begin(HelixTransport& io, bool publish = false);
+    void loop();
+
+    // Transport → ring. Safe from the UART event task; returns false when
+    // the ring filled up before the transport was empty.
+    bool rx_pump();
+    void rx_error(HelixRxError e);
+
+    // ms until loop() has TX work due (UINT32_MAX = nothing pending)
+    uint32_t next_due_ms() const;
+
+    // Encoder intent: step the master volume and queue it for the DSP
+    void volume_delta(int clicks);
+
+    bool ready() const { return hs_.ready(); }
+    const HelixMaster& master() const { return master_; }
+    const DspState& dsp_state() const { return blob_.state(); }
+    bool dsp_subscribe(DspField field, dsp_field_cb cb, void* ctx = nullptr)
+    {
+        return blob_.subscribe(field, cb, ctx);
+    }
+
+    const HelixLinkStats& link_stats() const { return hs_.stats(); }
+    const HelixParserStats& rx_stats() const { return rx_parser_.stats(); }
+    const HelixRxPathStats& rx_path_stats() const { return rx_path_; }
+    const HelixTxStats& tx_stats() const { return tx_.stats(); }
+
+private:
+    struct FrameHandler {
+        uint8_t len;
+        void (HelixLink::*fn)(const HelixFrame& f);
+    };
+    static const FrameHandler frame_handlers_[];
+
+    static void on_frame(const HelixFrame& f, void* ctx);
+    static void on_master_field(DspField field, uint16_t value, void* ctx);
+    void on_ready(const HelixFrame& f);
+    void on_blob(const HelixFrame& f);
+
+    HelixTransport* io_ = nullptr;
+    bool publish_ = false;
+    std::atomic_flag rx_pumping_ = ATOMIC_FLAG_INIT;
+
+    uint8_t rx_buf_[HELIX_RX_RING_SIZE];
+    HelixRing rx_ring_;
+    HelixParser rx_parser_;
+    DspBlobDecoder blob_;           // streams 0x50-byte blobs into DspState
+    HelixHandshake hs_;             // HS0 → ready frame → HS1 → blob
+    HelixTx tx_;                    // latest value per parameter, rate limited
+    HelixMaster master_ = {};
+    HelixRxPathStats rx_path_ = {};
+};
+
+// Per-link RAM, checked here so growth shows up as a build error
+#ifndef HELIX_LINK_MAX_BYTES
+#define HELIX_LINK_MAX_BYTES (HELIX_RX_RING_SIZE + 768)
+#endif
+
+constexpr size_t HELIX_LINK_FOOTPRINT = sizeof(HelixLink);
+static_assert(HELIX_LINK_FOOTPRINT <= HELIX_LINK_MAX_BYTES, "HelixLink outgrew HELIX_LINK_MAX_BYTES");
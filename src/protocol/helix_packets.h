@@ -0,0 +1,110 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "helix_frames.h"
+
+// ---------------- Compile-time packet builder ----------------
+// Outgoing packets are built by constexpr functions, so a constant
+// command (HS0, HS1) is a finished byte array in flash and a variable
+// one starts from a prebuilt template. patch() rewrites a single byte
+// and moves the checksum by the same delta; both checksums below are
+// plain additive sums, so that is exact.
+//
+// Two layouts exist on the wire:
+//   helix_frame(payload...)   42 len ~len | payload | sum(bytes after 42)
+//   helix_param_write(g,i,v)  42 06 F9 | 01 g i v | sum(all 7 bytes)
+// The parameter write is the firmware's original volume packet, kept
+// byte for byte: its len byte does not match the 4-byte payload and its
+// checksum includes the sync byte. The DSP accepts it as is.
+
+template <size_t N>
+struct HelixPacket {
+    static constexpr size_t size = N;
+    static constexpr size_t sum_at = N - 1;
+
+    uint8_t bytes[N];
+
+    constexpr uint8_t operator[](size_t i) const { return bytes[i]; }
+    const uint8_t* data() const { return bytes; }
+
+    constexpr void patch(size_t at, uint8_t value)
+    {
+        bytes[sum_at] = (uint8_t)(bytes[sum_at] + value - bytes[at]);
+        bytes[at] = value;
+    }
+};
+
+template <typename... B>
+constexpr HelixPacket<sizeof...(B) + HELIX_OVERHEAD> helix_frame(B... payload)
+{
+    static_assert(sizeof...(B) <= HELIX_MAX_PAYLOAD, "payload too long");
+
+    HelixPacket<sizeof...(B) + HELIX_OVERHEAD> p = {};
+    const uint8_t body[] = { (uint8_t)payload... };
+    p.bytes[0] = HELIX_SYNC;
+    p.bytes[1] = (uint8_t)sizeof...(B);
+    p.bytes[2] = (uint8_t)~sizeof...(B);
+    uint8_t sum = p.bytes[1] + p.bytes[2];
+    for (size_t i = 0; i < sizeof...(B); i++) {
+        p.bytes[HELIX_HEADER_LEN + i] = body[i];
+        sum += body[i];
+    }
+    p.bytes[p.sum_at] = sum;
+    return p;
+}
+
+// Parameter write (legacy layout, see above)
+#define HELIX_DEV_ADDR          0x01
+#define HELIX_PARAM_LEN_BYTE    0x06
+#define HELIX_PARAM_GROUP_AT    4
+#define HELIX_PARAM_ID_AT       5
+#define HELIX_PARAM_VALUE_AT    6
+
+using HelixParamPacket = HelixPacket<8>;
+
+constexpr HelixParamPacket helix_param_write(uint8_t group, uint8_t id, uint8_t value)
+{
+    HelixParamPacket p = { { HELIX_SYNC, HELIX_PARAM_LEN_BYTE, (uint8_t)~HELIX_PARAM_LEN_BYTE,
+                             HELIX_DEV_ADDR, group, id, value, 0 } };
+    uint8_t sum = 0;
+    for (size_t i = 0; i < p.sum_at; i++)
+        sum += p.bytes[i];
+    p.bytes[p.sum_at] = sum;
+    return p;
+}
+
+// Handshake commands: 01 2A 00 = hello, 01 2A 03 = send configuration
+constexpr auto HELIX_HS0 = helix_frame(HELIX_DEV_ADDR, 0x2A, 0x00);
+constexpr auto HELIX_HS1 = helix_frame(HELIX_DEV_ADDR, 0x2A, 0x03);
+
+// ---------------- Layout checks ----------------
+// Against the hand-written packets these replace.
+template <size_t N>
+constexpr bool helix_packet_is(const HelixPacket<N>& p, const uint8_t (&ref)[N])
+{
+    for (size_t i = 0; i < N; i++)
+        if (p[i] != ref[i]) return false;
+    return true;
+}
+
+namespace helix_packet_checks {
+constexpr uint8_t hs0[] = { 0x42, 0x03, 0xFC, 0x01, 0x2A, 0x00, 0x2A };
+constexpr uint8_t hs1[] = { 0x42, 0x03, 0xFC, 0x01, 0x2A, 0x03, 0x2D };
+constexpr uint8_t vol60[] = { 0x42, 0x06, 0xF9, 0x01, 0x2A, 0x04, 0x3C, 0xAC };
+constexpr uint8_t vol255[] = { 0x42, 0x06, 0xF9, 0x01, 0x2A, 0x04, 0xFF, 0x6F };
+
+constexpr HelixParamPacket patched(uint8_t from, uint8_t to)
+{
+    HelixParamPacket p = helix_param_write(0x2A, 0x04, from);
+    p.patch(HELIX_PARAM_VALUE_AT, to);
+    return p;
+}
+
+static_assert(helix_packet_is(HELIX_HS0, hs0), "HS0 bytes changed");
+static_assert(helix_packet_is(HELIX_HS1, hs1), "HS1 bytes changed");
+static_assert(helix_packet_is(helix_param_write(0x2A, 0x04, 0x3C), vol60), "param write layout changed");
+static_assert(helix_packet_is(helix_param_write(0x2A, 0x04, 0xFF), vol255), "param write checksum wrap");
+static_assert(helix_packet_is(patched(0x00, 0x3C), vol60), "patch() checksum drift");
+static_assert(helix_packet_is(patched(0xFF, 0x3C), vol60), "patch() checksum drift (wrap)");
+static_assert(HELIX_HS0.sum_at == 6 && HelixParamPacket::size == 8, "packet sizes");
+}
@@ -0,0 +1,116 @@
+#include "helix_parser.h"
+
+void HelixParser::begin(helix_frame_cb cb, void* ctx)
+{
+    cb_ = cb;
+    ctx_ = ctx;
+    stats_ = {};
+    reset();
+}
+
+void HelixParser::reset()
+{
+    stream_end(false);
+    state_ = SYNC;
+    len_ = 0;
+    sum_ = 0;
+    pos_ = 0;
+    released_ = 0;
+}
+
+void HelixParser::stream_end(bool ok)
+{
+    if (streaming_) {
+        streaming_ = false;
+        hooks_->end(ok, hooks_->ctx);
+    }
+}
+
+void HelixParser::reject(HelixRing& ring, uint32_t* counter)
+{
+    (*counter)++;
+    // Drop the sync byte and rescan what followed it. A streamed frame
+    // already gave its bytes away; resume at the bad checksum byte.
+    ring.consume(released_ ? 0 : 1);
+    reset();
+}
+
+void HelixParser::poll(HelixRing& ring)
+{
+    while (pos_ < ring.size()) {
+        switch (state_) {
+        case SYNC: {
+            // Skip noise a whole span at a time
+            uint32_t n;
+            const uint8_t* p = ring.read_span(0, &n);
+            uint32_t i = 0;
+            while (i < n && p[i] != HELIX_SYNC) i++;
+            if (i) {
+                stats_.bytes_skipped += i;
+                ring.consume(i);
+            }
+            if (i < n) {
+                state_ = LEN;
+                pos_ = 1;
+            }
+            break;
+        }
+
+        case LEN:
+            len_ = ring.peek(pos_++);
+            sum_ = len_;
+            state_ = NLEN;
+            break;
+
+        case NLEN: {
+            uint8_t b = ring.peek(pos_);
+            if (b != (uint8_t)~len_) {
+                reject(ring, &stats_.bad_length);
+                break;
+            }
+            sum_ += b;
+            pos_++;
+            state_ = len_ ? PAYLOAD : CHECKSUM;
+            if (len_ && hooks_)
+                streaming_ = hooks_->start(len_, hooks_->ctx);
+            break;
+        }
+
+        case PAYLOAD: {
+            uint32_t n;
+            const uint8_t* p = ring.read_span(pos_, &n);
+            uint32_t left = HELIX_HEADER_LEN + len_ - released_ - pos_;
+            if (n > left) n = left;
+            uint8_t s = sum_;
+            for (uint32_t i = 0; i < n; i++) s += p[i];
+            sum_ = s;
+            pos_ += n;
+            if (streaming_) {
+                hooks_->bytes(released_ + pos_ - n - HELIX_HEADER_LEN, p, n, hooks_->ctx);
+                // The sink has these bytes: free them so a streamed frame
+                // never needs to fit in the ring as a whole
+                ring.consume(pos_);
+                released_ += pos_;
+                pos_ = 0;
+            }
+            if (n == left) state_ = CHECKSUM;
+            break;
+        }
+
+        case CHECKSUM:
+            if (ring.peek(pos_) != sum_) {
+                reject(ring, &stats_.bad_checksum);
+                break;
+            }
+            stats_.frames_ok++;
+            stream_end(true);
+            if (cb_) {
+                HelixFrame f = { released_ ? nullptr : &ring, ring.tail() + HELIX_HEADER_LEN, len_ };
+                cb_(f, ctx_);
+            }
+            ring.consume(HELIX_OVERHEAD + len_ - released_);
+            reset();
+            break;
+        }
+    }
+}
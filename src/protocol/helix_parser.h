@@ -0,0 +1,77 @@
+#pragma once
+#include <stdint.h>
+#include "helix_frames.h"
+#include "helix_ring.h"
+
+// ---------------- Frame view ----------------
+// A validated frame still sitting in the RX ring. Valid only for the
+// duration of the handler call; bytes are read in place, never copied.
+// Frames taken by stream hooks have already left the ring: ring is
+// nullptr and only len is meaningful.
+struct HelixFrame {
+    const HelixRing* ring;
+    uint32_t start;     // absolute ring index of payload[0]
+    uint8_t  len;
+
+    uint8_t operator[](uint8_t i) const { return ring ? ring->at(start + i) : 0; }
+    uint8_t addr()  const { return len > 0 ? (*this)[0] : 0; }
+    uint8_t group() const { return len > 1 ? (*this)[1] : 0; }
+    uint8_t id()    const { return len > 2 ? (*this)[2] : 0; }
+};
+
+// Rejections, one counter per error class
+struct HelixParserStats {
+    uint32_t frames_ok;
+    uint32_t bytes_skipped;     // noise while hunting for 0x42
+    uint32_t bad_length;        // ~len did not match len
+    uint32_t bad_checksum;
+};
+
+typedef void (*helix_frame_cb)(const HelixFrame& frame, void* ctx);
+
+// Optional payload streaming for large frames. start() sees the length
+// once ~len checks out and returns true to receive that frame's payload;
+// bytes() then gets it in ring-contiguous pieces as they arrive; end()
+// reports whether the checksum accepted the frame. Anything decoded
+// before end(true) must be treated as provisional. Streamed bytes are
+// consumed from the ring as they are handed over, so after a bad
+// checksum the parser cannot rescan inside that payload.
+struct HelixStreamHooks {
+    bool (*start)(uint8_t len, void* ctx);
+    void (*bytes)(uint32_t offset, const uint8_t* p, uint32_t n, void* ctx);
+    void (*end)(bool ok, void* ctx);
+    void* ctx;
+};
+
+// ---------------- Incremental parser ----------------
+// Walks the ring byte by byte across poll() calls and only consumes
+// bytes once a frame is delivered or rejected. A rejected frame drops
+// just its sync byte, so a 0x42 inside garbage cannot hide a real frame.
+class HelixParser {
+public:
+    void begin(helix_frame_cb cb, void* ctx = nullptr);
+    void setStream(const HelixStreamHooks* hooks) { hooks_ = hooks; }
+    void reset();
+
+    // Parse everything currently in the ring
+    void poll(HelixRing& ring);
+
+    const HelixParserStats& stats() const { return stats_; }
+
+private:
+    enum State : uint8_t { SYNC, LEN, NLEN, PAYLOAD, CHECKSUM };
+
+    void reject(HelixRing& ring, uint32_t* counter);
+    void stream_end(bool ok);
+
+    helix_frame_cb cb_ = nullptr;
+    void* ctx_ = nullptr;
+    const HelixStreamHooks* hooks_ = nullptr;
+    bool streaming_ = false;    // hooks_ accepted the current frame
+    State state_ = SYNC;
+    uint8_t len_ = 0;
+    uint8_t sum_ = 0;
+    uint32_t pos_ = 0;      // bytes examined past ring tail
+    uint32_t released_ = 0; // bytes of a streamed frame already consumed
+    HelixParserStats stats_ = {};
+};
@@ -1,77 +1,76 @@
 #include "helix_protocol.h"
 
-static HardwareSerial* dsp = nullptr;
-static bool ready = false;
-
-// TEMP until blob parsed
-static int masterIndex = 60;
-static int masterSteps = 60;
-static float stepDb = 0.5f;
-
-// Handshake packets
-static const uint8_t HS0[] = {0x42,0x03,0xFC,0x01,0x2A,0x00,0x2A};
-static const uint8_t HS1[] = {0x42,0x03,0xFC,0x01,0x2A,0x03,0x2D};
+// The controller's one DSP: a publishing HelixLink on a HardwareSerial
+static HelixLink link;
+static HelixSerialTransport link_io;
 
 void helix_begin(HardwareSerial& dspSerial)
 {
-    dsp = &dspSerial;
-    ready = false;
-
-    Serial.println("[HELIX] starting handshake");
-    dsp->write(HS0, sizeof(HS0));
+    link_io.attach(dspSerial);
+    link.begin(link_io, true);
 }
 
 void helix_loop()
 {
-    while (dsp->available()) {
-        uint8_t b = dsp->read();
-        Serial.printf("%02X ", b);
+    link.loop();
+}
+
+bool helix_rx_pump()
+{
+    return link.rx_pump();
+}
+
+void helix_rx_error(HelixRxError e)
+{
+    link.rx_error(e);
+}
 
-        // crude markers for now
-        if (b == 0xAF) {
-            Serial.println("\n[HELIX] blob detected");
-        }
-        if (b == 0xFB) {
-            ready = true;
-            Serial.println("\n[HELIX] READY");
-        }
-    }
+uint32_t helix_next_due_ms()
+{
+    return link.next_due_ms();
 }
 
 bool helix_ready()
 {
-    return ready;
+    return link.ready();
 }
 
-void helix_volume_delta(int8_t clicks)
+HelixLink& helix_link()
 {
-    if (!ready) {
-        Serial.println("[HELIX] volume ignored (not ready)");
-        return;
-    }
+    return link;
+}
 
-    masterIndex += clicks;
-    if (masterIndex < 0) masterIndex = 0;
-    if (masterIndex > masterSteps * 2)
-        masterIndex = masterSteps * 2;
+const HelixLinkStats& helix_link_stats()
+{
+    return link.link_stats();
+}
 
-    uint8_t pkt[] = {
-        0x42,0x06,0xF9,
-        0x01,0x2A,0x04,
-        (uint8_t)masterIndex,
-        0x00
-    };
+const HelixParserStats& helix_rx_stats()
+{
+    return link.rx_stats();
+}
 
-    uint8_t sum = 0;
-    for (int i = 0; i < sizeof(pkt) - 1; i++)
-        sum += pkt[i];
-    pkt[sizeof(pkt) - 1] = sum;
+const HelixRxPathStats& helix_rx_path_stats()
+{
+    return link.rx_path_stats();
+}
 
-    dsp->write(pkt, sizeof(pkt));
+const HelixTxStats& helix_tx_stats()
+{
+    return link.tx_stats();
+}
 
-    Serial.printf(
-        "[VOL] idx=%d  db=%.1f\n",
-        masterIndex,
-        (masterIndex - masterSteps) * stepDb
-    );
+const DspState& helix_dsp_state()
+{
+    return link.dsp_state();
+}
+
+bool helix_dsp_subscribe(DspField field, dsp_field_cb cb, void* ctx)
+{
+    return link.dsp_subscribe(field, cb, ctx);
+}
+
+void helix_volume_delta(int clicks)
+{
+    link.volume_delta(clicks);
 }
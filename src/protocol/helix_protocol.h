@@ -1,10 +1,42 @@
 #pragma once
 #include <Arduino.h>
+#include "helix_link.h"
+
+// ---------------- Controller's DSP link ----------------
+// The firmware drives one DSP: a publishing HelixLink (helix_link.h)
+// over a HardwareSerial. These wrap that link for main.cpp and the
+// pages; more links can be made directly from HelixLink.
 
 void helix_begin(HardwareSerial& dsp);
 void helix_loop();
 
+// RX path, see HelixLink::rx_pump()
+bool helix_rx_pump();
+void helix_rx_error(HelixRxError e);
+const HelixRxPathStats& helix_rx_path_stats();
+
+HelixLink& helix_link();
+
+// ms until helix_loop() has TX work due (UINT32_MAX = nothing pending)
+uint32_t helix_next_due_ms();
+
+// True once the handshake (helix_handshake.h) has fetched the blob
 bool helix_ready();
 
-// Encoder → DSP intent
-void helix_volume_delta(int8_t clicks);
+// Handshake counters, including time-to-ready
+const HelixLinkStats& helix_link_stats();
+
+// RX frame counters (accepted / rejected per error class)
+const HelixParserStats& helix_rx_stats();
+
+// TX scheduler counters (coalesced vs sent)
+const HelixTxStats& helix_tx_stats();
+
+// DSP configuration decoded from the blob, and per-field change callbacks
+// (subscribe after helix_begin(), which resets the decoder)
+const DspState& helix_dsp_state();
+bool helix_dsp_subscribe(DspField field, dsp_field_cb cb, void* ctx = nullptr);
+
+// Encoder → DSP intent. Applied to model/params.h (param_master_index),
+// which the UI observes, and queued for the DSP.
+void helix_volume_delta(int clicks);
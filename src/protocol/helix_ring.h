@@ -0,0 +1,76 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+// ---------------- Byte ring (single producer / single consumer) ----------------
+// Storage is owned by the caller; capacity must be a power of two (and
+// at least HELIX_MAX_FRAME when a parser runs over it).
+// Indices run free and are masked on access, so size() is head - tail.
+// The producer only moves head, the consumer only moves tail, which keeps
+// it safe to fill from an ISR while loop() parses.
+
+class HelixRing {
+public:
+    HelixRing(uint8_t* buf, uint32_t capacity)
+        : buf_(buf), mask_(capacity - 1) {}
+
+    uint32_t capacity() const { return mask_ + 1; }
+    uint32_t size() const { return head_.load(std::memory_order_acquire) - tail_; }
+    uint32_t space() const { return capacity() - (head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_acquire)); }
+
+    // Consumer side: random access relative to tail, then release
+    uint8_t peek(uint32_t i) const { return buf_[(tail_ + i) & mask_]; }
+    uint8_t at(uint32_t abs_index) const { return buf_[abs_index & mask_]; }
+    uint32_t tail() const { return tail_; }
+    void consume(uint32_t n) { tail_.store(tail_ + n, std::memory_order_release); }
+
+    // Contiguous readable span starting i bytes past tail
+    const uint8_t* read_span(uint32_t i, uint32_t* len) const
+    {
+        uint32_t idx = (tail_ + i) & mask_;
+        uint32_t avail = size() - i;
+        uint32_t to_end = capacity() - idx;
+        *len = avail < to_end ? avail : to_end;
+        return &buf_[idx];
+    }
+
+    // Producer side. Returns bytes accepted; the rest count as overflow.
+    uint32_t push(const uint8_t* data, uint32_t n)
+    {
+        uint32_t free = space();
+        if (n > free) {
+            overflow_ += n - free;
+            n = free;
+        }
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        uint32_t idx = head & mask_;
+        uint32_t first = capacity() - idx;
+        if (first > n) first = n;
+        memcpy(&buf_[idx], data, first);
+        memcpy(&buf_[0], data + first, n - first);
+        head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    // Contiguous writable span; call commit() with the bytes actually written
+    uint8_t* write_span(uint32_t* len)
+    {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        uint32_t idx = head & mask_;
+        uint32_t free = space();
+        uint32_t to_end = capacity() - idx;
+        *len = free < to_end ? free : to_end;
+        return &buf_[idx];
+    }
+    void commit(uint32_t n) { head_.store(head_.load(std::memory_order_relaxed) + n, std::memory_order_release); }
+
+    uint32_t overflow() const { return overflow_; }
+
+private:
+    uint8_t* buf_;
+    uint32_t mask_;
+    std::atomic<uint32_t> head_{0};
+    std::atomic<uint32_t> tail_{0};
+    uint32_t overflow_ = 0;
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include <Arduino.h>
+
+// ---------------- Byte transport ----------------
+// All a HelixLink needs from the wire: reads of what has already
+// arrived, and writes that only happen when the TX side has room.
+// Nothing here may block. HelixSerialTransport adapts a HardwareSerial
+// (the UART on target, the stand-ins on host); a second UART, a pty or
+// an in-memory loopback implements the same four calls.
+
+class HelixTransport {
+public:
+    virtual int available() = 0;
+    virtual size_t read(uint8_t* buf, size_t len) = 0;
+    virtual int availableForWrite() = 0;
+    virtual size_t write(const uint8_t* buf, size_t len) = 0;
+
+protected:
+    ~HelixTransport() = default;    // links never own their transport
+};
+
+class HelixSerialTransport : public HelixTransport {
+public:
+    HelixSerialTransport() = default;
+    explicit HelixSerialTransport(HardwareSerial& s) : s_(&s) {}
+    void attach(HardwareSerial& s) { s_ = &s; }
+
+    int available() override { return s_->available(); }
+    size_t read(uint8_t* buf, size_t len) override { return s_->read(buf, len); }
+    int availableForWrite() override { return s_->availableForWrite(); }
+    size_t write(const uint8_t* buf, size_t len) override { return s_->write(buf, len); }
+
+private:
+    HardwareSerial* s_ = nullptr;
+};
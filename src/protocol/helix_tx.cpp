@@ -0,0 +1,97 @@
+#include "helix_tx.h"
+#include "log/lat_trace.h"
+
+void HelixTx::begin(HelixTransport& out, uint32_t min_interval_ms)
+{
+    out_ = &out;
+    min_interval_ms_ = min_interval_ms;
+    last_tx_ms_ = 0;
+    next_ = 0;
+    for (Slot& s : slots_) s = {};
+    stats_ = {};
+}
+
+void HelixTx::set(uint8_t group, uint8_t id, uint8_t value)
+{
+    stats_.requested++;
+
+    Slot* free_slot = nullptr;
+    for (Slot& s : slots_) {
+        if (s.used && s.group == group && s.id == id) {
+            if (s.pending) stats_.coalesced++;
+            s.value = value;
+            // Back to what the DSP already has: nothing to send
+            s.pending = !(s.ever_sent && s.sent_value == value);
+            if (traced_ && !s.pending) lat_trace_tx_coalesced();
+            return;
+        }
+        if (!s.used && !free_slot) free_slot = &s;
+    }
+
+    if (!free_slot) return;     // table full; HELIX_TX_SLOTS covers every param we drive
+    *free_slot = { group, id, value, 0, true, true, false, helix_param_write(group, id, value) };
+}
+
+void HelixTx::assume(uint8_t group, uint8_t id, uint8_t value)
+{
+    Slot* free_slot = nullptr;
+    for (Slot& s : slots_) {
+        if (s.used && s.group == group && s.id == id) {
+            s.sent_value = value;
+            s.ever_sent = true;
+            if (s.pending && s.value == value) {
+                s.pending = false;
+                if (traced_) lat_trace_tx_coalesced();
+            }
+            return;
+        }
+        if (!s.used && !free_slot) free_slot = &s;
+    }
+    if (free_slot) *free_slot = { group, id, value, value, true, false, true, helix_param_write(group, id, value) };
+}
+
+void HelixTx::poll(uint32_t now_ms)
+{
+    if (!out_) return;
+    if (now_ms - last_tx_ms_ < min_interval_ms_) return;
+
+    for (int n = 0; n < HELIX_TX_SLOTS; n++) {
+        Slot& s = slots_[(next_ + n) % HELIX_TX_SLOTS];
+        if (!s.pending) continue;
+
+        if (out_->availableForWrite() < (int)s.pkt.size) {
+            stats_.tx_busy++;
+            return;
+        }
+
+        s.pkt.patch(HELIX_PARAM_VALUE_AT, s.value);
+        out_->write(s.pkt.data(), s.pkt.size);
+        if (traced_) lat_trace_mark(LAT_TX);
+        s.pending = false;
+        s.ever_sent = true;
+        s.sent_value = s.value;
+        stats_.sent++;
+        last_tx_ms_ = now_ms;
+        next_ = (next_ + n + 1) % HELIX_TX_SLOTS;
+        return;
+    }
+}
+
+bool HelixTx::idle() const
+{
+    for (const Slot& s : slots_)
+        if (s.pending) return false;
+    return true;
+}
+
+uint32_t HelixTx::next_due_ms(uint32_t now_ms) const
+{
+    if (!out_ || idle()) return UINT32_MAX;
+
+    uint32_t since = now_ms - last_tx_ms_;
+    if (since < min_interval_ms_) return min_interval_ms_ - since;
+
+    // Interval already elapsed but still pending: poll() found the TX
+    // FIFO full, which drains within a millisecond at our baud rate
+    return 1;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <Arduino.h>
+#include "helix_transport.h"
+#include "helix_packets.h"
+
+// ---------------- Coalescing TX scheduler ----------------
+// One slot per DSP parameter (group/id). set() only records the latest
+// absolute value; poll() sends at most one packet per min interval and
+// only when the UART TX FIFO has room, so loop() never blocks on TX.
+// Values overwritten before they went out count as coalesced.
+
+#ifndef HELIX_TX_MIN_INTERVAL_MS
+#define HELIX_TX_MIN_INTERVAL_MS 20     // ≤ 50 packets/s
+#endif
+
+#define HELIX_TX_SLOTS 8
+
+struct HelixTxStats {
+    uint32_t requested;     // set() calls
+    uint32_t coalesced;     // values superseded before being sent
+    uint32_t sent;          // packets written to the UART
+    uint32_t tx_busy;       // polls deferred because the TX FIFO was full
+};
+
+class HelixTx {
+public:
+    void begin(HelixTransport& out, uint32_t min_interval_ms = HELIX_TX_MIN_INTERVAL_MS);
+    void setMinInterval(uint32_t ms) { min_interval_ms_ = ms; }
+
+    // Stamp LAT_TX on the latency trace when a packet goes out, or close
+    // it without TX when a pending write is dropped. Only the link
+    // carrying the encoder's volume turns this on.
+    void setTraced(bool on) { traced_ = on; }
+
+    void set(uint8_t group, uint8_t id, uint8_t value);
+
+    // The DSP reported `value` itself: nothing to send for it, and a
+    // pending write of the same value is dropped (no echo)
+    void assume(uint8_t group, uint8_t id, uint8_t value);
+    void poll(uint32_t now_ms);
+
+    bool idle() const;
+
+    // ms until poll() has something to send: 0 = now, UINT32_MAX = idle
+    uint32_t next_due_ms(uint32_t now_ms) const;
+    const HelixTxStats& stats() const { return stats_; }
+
+private:
+    struct Slot {
+        uint8_t group, id;
+        uint8_t value;
+        uint8_t sent_value;
+        bool used, pending, ever_sent;
+        HelixParamPacket pkt;   // built once per slot; poll() patches the value
+    };
+
+    HelixTransport* out_ = nullptr;
+    uint32_t min_interval_ms_ = HELIX_TX_MIN_INTERVAL_MS;
+    uint32_t last_tx_ms_ = 0;
+    uint8_t next_ = 0;      // round-robin start so one busy slot can't starve others
+    bool traced_ = false;
+    Slot slots_[HELIX_TX_SLOTS] = {};
+    HelixTxStats stats_ = {};
+};
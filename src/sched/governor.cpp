@@ -0,0 +1,152 @@
+#include "governor.h"
+#include "display/display.h"
+#include <driver/gpio.h>
+#include <driver/uart.h>
+#include <esp_sleep.h>
+
+static lv_display_t* disp = nullptr;
+static GovWakeSources wake;
+static GovMode mode = GOV_ACTIVE;
+static uint32_t last_activity_ms = 0;
+static uint32_t last_update_ms = 0;
+static GovStats stats;
+
+// Wake-to-frame measurement, armed by a GPIO wake
+static bool w2f_armed = false;
+static uint32_t w2f_t0_us = 0;
+
+static void apply_mode(GovMode m)
+{
+    lv_timer_t* refr = lv_display_get_refr_timer(disp);
+    switch (m) {
+    case GOV_ACTIVE:
+        lv_timer_set_period(refr, GOV_ACTIVE_REFR_MS);
+        lv_timer_resume(refr);
+        break;
+    case GOV_SETTLED:
+        lv_timer_set_period(refr, GOV_SETTLED_REFR_MS);
+        lv_timer_resume(refr);
+        break;
+    default:
+        // Nothing due: let lv_timer_handler() report no deadline at all.
+        // lv_obj_invalidate() resumes it when something does change.
+        lv_timer_pause(refr);
+        break;
+    }
+    mode = m;
+}
+
+void gov_begin(lv_display_t* d, const GovWakeSources& src)
+{
+    disp = d;
+    wake = src;
+    stats = {};
+    last_activity_ms = last_update_ms = millis();
+    apply_mode(GOV_ACTIVE);
+}
+
+void gov_activity(uint32_t now_ms)
+{
+    last_activity_ms = now_ms;
+    if (mode != GOV_ACTIVE) apply_mode(GOV_ACTIVE);
+}
+
+GovMode gov_update(uint32_t now_ms)
+{
+    stats.mode_ms[mode] += now_ms - last_update_ms;
+    last_update_ms = now_ms;
+
+    uint32_t quiet = now_ms - last_activity_ms;
+    GovMode m = quiet < GOV_ACTIVE_HOLD_MS ? GOV_ACTIVE
+              : quiet < GOV_IDLE_AFTER_MS  ? GOV_SETTLED
+              : GOV_IDLE;
+    if (m != mode) apply_mode(m);
+
+    if (w2f_armed) {
+        uint32_t t = display_last_frame_us();
+        if ((int32_t)(t - w2f_t0_us) > 0) {
+            uint32_t us = t - w2f_t0_us;
+            stats.w2f_n++;
+            stats.w2f_sum_us += us;
+            if (us > stats.w2f_max_us) stats.w2f_max_us = us;
+            w2f_armed = false;
+        } else if (micros() - w2f_t0_us > GOV_ACTIVE_HOLD_MS * 1000u) {
+            w2f_armed = false;  // woke for nothing visible (e.g. a button press)
+        }
+    }
+    return mode;
+}
+
+GovMode gov_mode()
+{
+    return mode;
+}
+
+GovWake gov_light_sleep(uint32_t ms)
+{
+#if GOV_LIGHT_SLEEP
+    if (ms == 0) return GOV_WAKE_NONE;     // already due: a 0 us timer is not a nap
+    w2f_armed = false;      // a wake that drew nothing is not a sample
+
+    // Wake on the opposite of each pin's level now. Mask the pins' own
+    // interrupts meanwhile: a level-type interrupt would otherwise fire
+    // continuously once the pin sits at its wake level.
+    for (uint8_t i = 0; i < wake.n_pins; i++) {
+        gpio_num_t pin = (gpio_num_t)wake.pins[i];
+        gpio_intr_disable(pin);
+        gpio_wakeup_enable(pin, gpio_get_level(pin) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+    }
+    esp_sleep_enable_gpio_wakeup();
+    if (wake.uart >= 0) {
+        uart_set_wakeup_threshold((uart_port_t)wake.uart, 3);   // minimum edges on RX
+        esp_sleep_enable_uart_wakeup(wake.uart);
+    }
+    if (ms != UINT32_MAX)
+        esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+
+    uint32_t t0 = millis();
+    esp_light_sleep_start();
+    uint32_t t1 = millis();
+    esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+
+    for (uint8_t i = 0; i < wake.n_pins; i++) {
+        gpio_num_t pin = (gpio_num_t)wake.pins[i];
+        gpio_wakeup_disable(pin);
+        gpio_set_intr_type(pin, GPIO_INTR_ANYEDGE);
+    }
+    if (wake.resample) wake.resample();
+    for (uint8_t i = 0; i < wake.n_pins; i++)
+        gpio_intr_enable((gpio_num_t)wake.pins[i]);
+
+    stats.sleeps++;
+    stats.slept_ms += t1 - t0;
+    last_update_ms = t1;            // sleep counts as IDLE time
+    stats.mode_ms[GOV_IDLE] += t1 - t0;
+
+    switch (cause) {
+    case ESP_SLEEP_WAKEUP_GPIO:
+        stats.wake_gpio++;
+        w2f_t0_us = micros();
+        w2f_armed = true;
+        gov_activity(t1);
+        return GOV_WAKE_GPIO;
+    case ESP_SLEEP_WAKEUP_UART:
+        stats.wake_uart++;
+        return GOV_WAKE_UART;
+    case ESP_SLEEP_WAKEUP_TIMER:
+        stats.wake_timer++;
+        return GOV_WAKE_TIMER;
+    default:
+        return GOV_WAKE_OTHER;
+    }
+#else
+    (void)ms;
+    return GOV_WAKE_NONE;
+#endif
+}
+
+const GovStats& gov_stats()
+{
+    return stats;
+}
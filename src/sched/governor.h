@@ -0,0 +1,86 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+// ---------------- Activity governor ----------------
+// Picks a power mode from the time since the last user input:
+//
+//   ACTIVE   knob moved within GOV_ACTIVE_HOLD_MS: fast refresh period
+//   SETTLED  quiet, but recently used: slow refresh period
+//   IDLE     quiet for GOV_IDLE_AFTER_MS: refresh timer paused and, with
+//            GOV_LIGHT_SLEEP, loop() light-sleeps instead of blocking
+//
+// Invalidating anything resumes LVGL's refresh timer, so DSP-originated
+// changes still reach the screen in IDLE. Light sleep wakes on any wake
+// pin leaving its current level, on UART RX activity, or on the next
+// deadline. The bytes that wake the UART are lost; the handshake
+// retries cover the rare frame that arrives that way.
+//
+// Light sleep is off by default: the C3's USB Serial/JTAG console
+// drops while asleep, and with it the reports and the perf dump. Build
+// with GOV_LIGHT_SLEEP=1 for a device that runs without a USB host.
+
+#ifndef GOV_LIGHT_SLEEP
+#define GOV_LIGHT_SLEEP 0
+#endif
+
+#ifndef GOV_ACTIVE_REFR_MS
+#define GOV_ACTIVE_REFR_MS  16      // ~60 Hz while the knob turns
+#endif
+
+#ifndef GOV_SETTLED_REFR_MS
+#define GOV_SETTLED_REFR_MS 100
+#endif
+
+#ifndef GOV_ACTIVE_HOLD_MS
+#define GOV_ACTIVE_HOLD_MS  1000
+#endif
+
+#ifndef GOV_IDLE_AFTER_MS
+#define GOV_IDLE_AFTER_MS   20000
+#endif
+
+#define GOV_MAX_WAKE_PINS   4
+
+enum GovMode : uint8_t { GOV_ACTIVE, GOV_SETTLED, GOV_IDLE, GOV_MODES };
+
+enum GovWake : uint8_t { GOV_WAKE_NONE, GOV_WAKE_GPIO, GOV_WAKE_UART, GOV_WAKE_TIMER, GOV_WAKE_OTHER };
+
+struct GovWakeSources {
+    uint8_t pins[GOV_MAX_WAKE_PINS];
+    uint8_t n_pins;
+    int8_t  uart;               // UART number, -1 = none
+    // Runs right after wake with the pins' interrupts still masked; the
+    // edge that woke the chip never reached the ISR, so re-sample here
+    void (*resample)();
+};
+
+struct GovStats {
+    uint32_t mode_ms[GOV_MODES];    // time spent per mode
+    uint32_t sleeps;
+    uint32_t wake_gpio, wake_uart, wake_timer;
+    uint32_t slept_ms;
+    // GPIO wake → end of the next frame, timed from the return of
+    // esp_light_sleep_start(): the chip's own wake-up (clocks, flash)
+    // comes before that and is not included
+    uint32_t w2f_n;
+    uint32_t w2f_sum_us;
+    uint32_t w2f_max_us;
+};
+
+void gov_begin(lv_display_t* disp, const GovWakeSources& src);
+
+// User input (detent, button); also implied by a GPIO wake
+void gov_activity(uint32_t now_ms);
+
+// Re-evaluate the mode and apply its refresh period; call once per pass
+GovMode gov_update(uint32_t now_ms);
+
+GovMode gov_mode();
+
+// Light-sleep for at most `ms` (UINT32_MAX = until a pin or the UART;
+// 0 = don't sleep, returns GOV_WAKE_NONE). Caller makes sure nothing is
+// left to do (console drained, UART TX done).
+GovWake gov_light_sleep(uint32_t ms);
+
+const GovStats& gov_stats();
@@ -0,0 +1,50 @@
+#include "ui_sched.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static TaskHandle_t ui_task = nullptr;
+static UiSchedStats stats;
+
+void ui_sched_begin()
+{
+    ui_task = xTaskGetCurrentTaskHandle();
+}
+
+void IRAM_ATTR ui_sched_wake_from_isr()
+{
+    if (!ui_task) return;
+    BaseType_t hp_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(ui_task, &hp_woken);
+    if (hp_woken) portYIELD_FROM_ISR();
+}
+
+void ui_sched_wake()
+{
+    if (ui_task) xTaskNotifyGive(ui_task);
+}
+
+bool ui_sched_wait(uint32_t ms)
+{
+    stats.passes++;
+
+    if (ms > UI_SCHED_MAX_SLEEP_MS) ms = UI_SCHED_MAX_SLEEP_MS;
+
+    // A pending notification (event during the last pass) returns at once;
+    // the count is cleared so a burst of edges costs one extra pass, not N
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms))) {
+        stats.woken++;
+        return true;
+    }
+    stats.timed_out++;
+    return false;
+}
+
+bool ui_sched_take_pending()
+{
+    return ulTaskNotifyTake(pdTRUE, 0) != 0;
+}
+
+const UiSchedStats& ui_sched_stats()
+{
+    return stats;
+}
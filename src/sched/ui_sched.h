@@ -0,0 +1,43 @@
+#pragma once
+#include <Arduino.h>
+
+// ---------------- UI task scheduler ----------------
+// loop() runs on Arduino's loopTask. Instead of polling every 5 ms it
+// blocks on a FreeRTOS task notification until either an event source
+// wakes it (encoder/button ISR, UART RX) or the earliest deadline it was
+// given passes (next LVGL timer, next rate-limited TX). All LVGL calls
+// stay on this one task, so lv_conf keeps LV_USE_OS = LV_OS_NONE.
+//
+// UI_EVENT_LOOP 0 restores the fixed delay(5) poll for A/B latency runs.
+
+#ifndef UI_EVENT_LOOP
+#define UI_EVENT_LOOP 1
+#endif
+
+#ifndef UI_SCHED_MAX_SLEEP_MS
+#define UI_SCHED_MAX_SLEEP_MS 1000  // upper bound so periodic reports still run
+#endif
+
+struct UiSchedStats {
+    uint32_t passes;        // loop() iterations
+    uint32_t woken;         // ended early by an event
+    uint32_t timed_out;     // slept until the deadline
+};
+
+// Call once from the task that will run the UI (setup() → loopTask)
+void ui_sched_begin();
+
+// Wake the UI task. _from_isr is IRAM-safe; the other is for task context
+// (e.g. HardwareSerial::onReceive, which runs on the UART event task).
+void ui_sched_wake_from_isr();
+void ui_sched_wake();
+
+// Sleep until woken or `ms` elapse; true if an event ended the wait.
+// Events that arrived while the caller was busy return immediately.
+bool ui_sched_wait(uint32_t ms);
+
+// Consume a wake that arrived since the last wait without blocking;
+// true if there was one (used before light sleep, which ignores it)
+bool ui_sched_take_pending();
+
+const UiSchedStats& ui_sched_stats();
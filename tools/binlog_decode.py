@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""Turn the firmware console stream back into text.
+
+The console carries two things: plain ASCII lines (boot messages and the
+periodic [DISP]/[ENC]/[LAT] reports) and binary log records from
+src/log/binlog.cpp:
+
+    0xB1  len  id  varint(millis)  zigzag-varint(arg)...
+
+Text passes through unchanged; records are formatted with the strings
+in src/log/binlog_msgs.h, prefixed with the device timestamp. Perf
+dumps (0xB2 'P', src/log/perf.h) are replaced by a one-line note; use
+tools/perf_view.py to read them.
+
+    python3 tools/binlog_decode.py /dev/ttyACM0        # live (needs pyserial)
+    python3 tools/binlog_decode.py capture.bin
+    cat capture.bin | python3 tools/binlog_decode.py -
+"""
+import os
+import re
+import sys
+
+SYNC = 0xB1
+PERF_SYNC, PERF_TAG = 0xB2, ord("P")
+MSGS_H = os.path.join(os.path.dirname(__file__), "..", "src", "log", "binlog_msgs.h")
+
+
+def load_table(path=MSGS_H):
+    """[(name, level, fmt)] in id order, parsed from the X-macro list."""
+    text = open(path, encoding="utf-8").read()
+    return [(m.group(1), m.group(2), m.group(3))
+            for m in re.finditer(r'X\((\w+),\s*(\w+),\s*"((?:[^"\\]|\\.)*)"\)', text)]
+
+
+def varints(buf):
+    """Decode a run of LEB128 varints; None if the buffer ends mid-value."""
+    out, v, shift = [], 0, 0
+    for b in buf:
+        v |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            out.append(v)
+            v, shift = 0, 0
+    return None if shift else out
+
+
+def unzigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+
+def format_msg(fmt, args):
+    """printf subset: %d %u %x %X with optional width, plus %D (tenths)."""
+    args = list(args)
+
+    def conv(m):
+        if m.group(0) == "%%":
+            return "%"
+        spec, kind = m.group(1), m.group(2)
+        v = args.pop(0) if args else 0
+        if kind == "D":
+            return "%s%d.%d" % ("-" if v < 0 else "", abs(v) // 10, abs(v) % 10)
+        if kind == "u":
+            v &= 0xFFFFFFFF
+            kind = "d"
+        return ("%" + spec + kind) % v
+
+    return re.sub(r"%%|%([-0-9]*)([duxXD])", conv, fmt)
+
+
+class Decoder:
+    def __init__(self, table, out=sys.stdout.buffer):
+        self.table = table
+        self.out = out
+        self.buf = bytearray()
+        self.bad = 0
+
+    def feed(self, data):
+        self.buf += data
+        while self.buf:
+            i = self.buf.find(SYNC)
+            p = self.buf.find(bytes([PERF_SYNC, PERF_TAG]))
+            if p >= 0 and (i < 0 or p < i):
+                i = p
+            if i == 0 and self.buf[0] == PERF_SYNC:
+                if len(self.buf) < 4:
+                    return
+                n = 4 + (self.buf[2] | self.buf[3] << 8) + 1
+                if len(self.buf) < n:
+                    return                      # wait for the rest of the dump
+                if sum(self.buf[4:n - 1]) & 0xFF != self.buf[n - 1]:
+                    self.bad += 1
+                    self.out.write(bytes(self.buf[:1]))
+                    del self.buf[:1]
+                    continue
+                self.out.write(("[perf dump, %d bytes: tools/perf_view.py]\n" % n).encode())
+                del self.buf[:n]
+                continue
+            if i != 0:
+                text = self.buf if i < 0 else self.buf[:i]
+                if i < 0 and text[-1] == PERF_SYNC:
+                    text = text[:-1]            # may be a dump whose 'P' is still in flight
+                    if not text:
+                        break
+                self.out.write(bytes(text))
+                del self.buf[:len(text)]
+                continue
+            if len(self.buf) < 2 or len(self.buf) < 2 + self.buf[1]:
+                return                          # wait for the rest of the record
+            rec = self.buf[2:2 + self.buf[1]]
+            line = self.record(rec)
+            if line is None:
+                # Not a record after all: emit the byte and resync
+                self.bad += 1
+                self.out.write(bytes(self.buf[:1]))
+                del self.buf[:1]
+                continue
+            self.out.write((line + "\n").encode())
+            del self.buf[:2 + len(rec)]
+        self.out.flush()
+
+    def record(self, rec):
+        if not rec or rec[0] >= len(self.table):
+            return None
+        vals = varints(rec[1:])
+        if not vals:
+            return None
+        name, level, fmt = self.table[rec[0]]
+        t_ms, args = vals[0], [unzigzag(v) for v in vals[1:]]
+        if len(args) != len(re.findall(r"%[-0-9]*[duxXD]", fmt)):
+            return None
+        return "%10.3f %s" % (t_ms / 1000.0, format_msg(fmt, args))
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else "-"
+    dec = Decoder(load_table())
+
+    if src == "-":
+        stream = sys.stdin.buffer
+    elif src.startswith("/dev/"):
+        import serial                           # pyserial, only for live ports
+        stream = serial.Serial(src, 115200, timeout=0.1)
+    else:
+        stream = open(src, "rb")
+
+    try:
+        while True:
+            data = stream.read(4096) if src.startswith("/dev/") else stream.read1(4096)
+            if not data:
+                if src.startswith("/dev/"):
+                    continue
+                break
+            dec.feed(data)
+    except KeyboardInterrupt:
+        pass
+    if dec.bad:
+        print("[binlog_decode] %d bytes skipped while resyncing" % dec.bad, file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
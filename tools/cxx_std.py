@@ -0,0 +1,10 @@
+"""PlatformIO pre-script: the C++ standard, for C++ sources only.
+
+build_flags also reach the C sources (LVGL, dial_ring_sprite.c), where a
+-std=gnu++NN only earns a warning per file. CXXFLAGS go to C++ alone.
+The code needs C++14 (constexpr functions with loops: RoundTable,
+helix_packets.h); it is built as gnu++17.
+"""
+Import("env")  # noqa: F821 (provided by SCons)
+
+env.Append(CXXFLAGS=["-std=gnu++17"])  # noqa: F821
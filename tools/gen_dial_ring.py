@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+"""Generate src/pages/dial_ring_sprite.{c,h}: the master dial ring,
+pre-rendered into flash.
+
+The ring matches master_dial_create(): 220x220 object, 24px wide,
+non-rounded, sweeping clockwise from 145 to 35 degrees (LVGL angles:
+0 = 3 o'clock, y down). It is stored as two opaque images, pre-blended
+on the page background: the whole ring in gray and the whole ring in
+green, cropped to the rows and columns the ring touches. Pixels are
+RGB565, written through DIAL_RING_RGB() so they compile into the
+display's byte order (RGB565_SWAPPED with DISPLAY_NATIVE_SWAP) and LVGL
+draws them from flash as a plain copy.
+
+To draw the green part up to a value, each pixel of the ring has its
+sweep angle in 0.5 degree units, and for every value the generator
+works out a short list of rectangles of the green image that covers the
+lit pixels and none of the unlit ones (checked pixel by pixel). The
+dial draws the gray image, then those rectangles as sub-images, each
+one a plain copy. Per-unit bounding boxes give the area a change from
+value a to b invalidates -- no trig or masks at runtime.
+
+    python3 tools/gen_dial_ring.py
+"""
+import math
+import os
+
+SIZE = 220
+WIDTH = 24
+START_DEG = 145
+SWEEP_DEG = 250
+UNITS_PER_DEG = 2
+UNITS = SWEEP_DEG * UNITS_PER_DEG
+SS = 4                      # supersamples per axis for anti-aliasing
+
+BG = 0x000000
+MAIN = 0xCCCCCC
+IND = 0x44CC44
+
+OUT_DIR = os.path.join(os.path.dirname(__file__), "..", "src", "pages")
+
+
+def rgb565(c):
+    r, g, b = (c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def blend(fg, bg, a):
+    out = 0
+    for sh in (16, 8, 0):
+        f, b = (fg >> sh) & 0xFF, (bg >> sh) & 0xFF
+        out |= int(round(b + (f - b) * a)) << sh
+    return out
+
+
+def sweep_pos(x, y):
+    """Degrees past START_DEG, clockwise, in [0, 360)."""
+    deg = math.degrees(math.atan2(y, x)) % 360.0
+    return (deg - START_DEG) % 360.0
+
+
+def main():
+    c = SIZE / 2.0
+    r_out = SIZE / 2.0
+    r_in = r_out - WIDTH
+
+    ring = {}               # (x, y) -> (unit, bg, ind)
+    for py in range(SIZE):
+        for px in range(SIZE):
+            hit = 0
+            for sy in range(SS):
+                for sx in range(SS):
+                    x = px + (sx + 0.5) / SS - c
+                    y = py + (sy + 0.5) / SS - c
+                    r = math.hypot(x, y)
+                    if r_in <= r <= r_out and sweep_pos(x, y) < SWEEP_DEG:
+                        hit += 1
+            if not hit:
+                continue
+            a = hit / float(SS * SS)
+            pos = sweep_pos(px + 0.5 - c, py + 0.5 - c)
+            if pos >= SWEEP_DEG:    # edge pixel just past an end
+                pos = 0.0 if pos > (360 + SWEEP_DEG) / 2.0 else SWEEP_DEG - 1e-6
+            unit = int(pos * UNITS_PER_DEG)
+            ring[(px, py)] = (unit, rgb565(blend(MAIN, BG, a)),
+                              rgb565(blend(IND, BG, a)))
+
+    # Images: the ring's bounding box, page background elsewhere
+    x0 = min(x for x, _ in ring)
+    y0 = min(y for _, y in ring)
+    iw = max(x for x, _ in ring) - x0 + 1
+    ih = max(y for _, y in ring) - y0 + 1
+    bg_img, ind_img = [], []
+    for y in range(y0, y0 + ih):
+        for x in range(x0, x0 + iw):
+            _, b, i = ring.get((x, y), (0, rgb565(BG), rgb565(BG)))
+            bg_img.append(b)
+            ind_img.append(i)
+
+    # Per value: rectangles of the green image that cover every lit ring
+    # pixel and no unlit one. Pixels off the ring are the background in
+    # both images, so a rectangle may run over them freely. Row by row,
+    # the unlit pixels cut the row into gaps; a rectangle grows down
+    # while the next row has a gap holding its columns, taking in that
+    # gap's lit pixels.
+    by_row = {}
+    for (x, y), v in ring.items():
+        by_row.setdefault(y - y0, []).append((x - x0, v[0]))
+
+    def cover(u):
+        done, live = [], []     # [allow_lo, allow_hi, x1, x2, y1]
+        for y in range(ih):
+            px = sorted(by_row.get(y, []))
+            cuts = [-1] + [x for x, unit in px if unit >= u] + [iw]
+            gaps = []
+            for a, b in zip(cuts, cuts[1:]):
+                if b - a > 1:
+                    lit = [x for x, unit in px if a < x < b]
+                    gaps.append([a + 1, b - 1, lit])
+            grown = []
+            for lo, hi, x1, x2, y1 in live:
+                g = next((g for g in gaps if g[0] <= x1 and x2 <= g[1]), None)
+                lo2, hi2 = (max(lo, g[0]), min(hi, g[1])) if g else (0, -1)
+                nx1, nx2 = x1, x2
+                if g and g[2]:
+                    nx1, nx2 = min(x1, g[2][0]), max(x2, g[2][-1])
+                if not g or nx1 < lo2 or nx2 > hi2:
+                    done.append((x1, y1, x2, y - 1))
+                    continue
+                if g[2]:
+                    g[2] = []
+                grown.append([lo2, hi2, nx1, nx2, y1])
+            for lo, hi, lit in gaps:
+                if lit:
+                    grown.append([lo, hi, lit[0], lit[-1], y])
+            live = grown
+        done += [(x1, y1, x2, ih - 1) for _, _, x1, x2, y1 in live]
+        return sorted(done, key=lambda r: (r[1], r[0]))
+
+    rects, first = [], []
+    for u in range(UNITS + 1):
+        first.append(len(rects))
+        got = cover(u)
+        for (x, y), v in ring.items():      # exact: lit iff unit < u
+            inside = any(r[0] <= x - x0 <= r[2] and r[1] <= y - y0 <= r[3] for r in got)
+            assert inside == (v[0] < u), (u, x, y)
+        rects.extend(got)
+    first.append(len(rects))
+    max_rects = max(b - a for a, b in zip(first, first[1:]))
+
+    boxes = []
+    for u in range(UNITS):
+        pts = [p for p, v in ring.items() if v[0] == u]
+        if pts:
+            boxes.append((min(x for x, _ in pts), min(y for _, y in pts),
+                          max(x for x, _ in pts), max(y for _, y in pts)))
+        else:
+            boxes.append((255, 255, 0, 0))      # empty: leaves a union alone
+
+    def arr(name, ctype, vals, fmt="0x%04X"):
+        lines = ["const %s %s[%d] = {" % (ctype, name, len(vals))]
+        for k in range(0, len(vals), 12):
+            lines.append("    " + ", ".join(fmt % v for v in vals[k:k + 12]) + ",")
+        lines.append("};")
+        return "\n".join(lines)
+
+    def structs(name, ctype, rows):
+        lines = ["const %s %s[%d] = {" % (ctype, name, len(rows))]
+        for k in range(0, len(rows), 6):
+            lines.append("    " + " ".join("{ %s }," % ", ".join("%d" % v for v in r)
+                                           for r in rows[k:k + 6]))
+        lines.append("};")
+        return "\n".join(lines)
+
+    with open(os.path.join(OUT_DIR, "dial_ring_sprite.h"), "w") as f:
+        f.write("""#pragma once
+#include <stdint.h>
+#include "display/display.h"
+
+// Generated by tools/gen_dial_ring.py -- do not edit.
+// Master dial ring as two flash images plus the tables that say which
+// part of the green one to draw (see the generator).
+
+#define DIAL_RING_SIZE      %d
+#define DIAL_RING_UNITS     %d      // sweep in 0.5 degree steps
+#define DIAL_RING_RECTS     %d
+#define DIAL_RING_MAX_RECTS %d      // most rectangles any one value needs
+
+// Pixels are stored in the display's byte order, so a draw is a copy
+#if DISPLAY_NATIVE_SWAP
+#define DIAL_RING_CF        LV_COLOR_FORMAT_RGB565_SWAPPED
+#define DIAL_RING_RGB(v)    (uint16_t)(((v) >> 8) | (((v) & 0xFF) << 8))
+#else
+#define DIAL_RING_CF        LV_COLOR_FORMAT_RGB565
+#define DIAL_RING_RGB(v)    (uint16_t)(v)
+#endif
+
+// Image placement inside the DIAL_RING_SIZE square
+#define DIAL_RING_IMG_X     %d
+#define DIAL_RING_IMG_Y     %d
+#define DIAL_RING_IMG_W     %d
+#define DIAL_RING_IMG_H     %d
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Inclusive; a rect is in image pixels, a box in DIAL_RING_SIZE pixels
+// (x1 > x2 if the unit has no pixels)
+typedef struct {
+    uint8_t x1, y1, x2, y2;
+} DialRingBox;
+
+// DIAL_RING_CF, pre-blended on the page background
+extern const uint16_t dial_ring_bg[DIAL_RING_IMG_W * DIAL_RING_IMG_H];
+extern const uint16_t dial_ring_ind[DIAL_RING_IMG_W * DIAL_RING_IMG_H];
+
+// Green rects for u lit units: [dial_ring_rect_first[u], dial_ring_rect_first[u + 1])
+extern const DialRingBox dial_ring_rects[DIAL_RING_RECTS];
+extern const uint16_t dial_ring_rect_first[DIAL_RING_UNITS + 2];
+extern const DialRingBox dial_ring_unit_box[DIAL_RING_UNITS];
+
+#ifdef __cplusplus
+}
+#endif
+""" % (SIZE, UNITS, len(rects), max_rects, x0, y0, iw, ih))
+
+    with open(os.path.join(OUT_DIR, "dial_ring_sprite.c"), "w") as f:
+        f.write("// Generated by tools/gen_dial_ring.py -- do not edit.\n")
+        f.write('#include "dial_ring_sprite.h"\n\n')
+        f.write("#define P(v) DIAL_RING_RGB(v)\n\n")
+        f.write(arr("dial_ring_bg", "uint16_t", bg_img, "P(0x%04X)") + "\n\n")
+        f.write(arr("dial_ring_ind", "uint16_t", ind_img, "P(0x%04X)") + "\n\n")
+        f.write("#undef P\n\n")
+        f.write(structs("dial_ring_rects", "DialRingBox", rects) + "\n\n")
+        f.write(arr("dial_ring_rect_first", "uint16_t", first, "%d") + "\n\n")
+        f.write(structs("dial_ring_unit_box", "DialRingBox", boxes) + "\n")
+
+    flash = len(bg_img) * 4 + len(rects) * 4 + len(first) * 2 + UNITS * 4
+    print("dial ring: %d px, %dx%d images, %d rects (at most %d per value), %d bytes of flash"
+          % (len(ring), iw, ih, len(rects), max_rects, flash))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""Request and show the firmware's performance histograms.
+
+src/log/perf.cpp answers a 'p' on the console with one binary frame:
+
+    0xB2  'P'  len16(LE)  payload  sum8(payload)
+
+holding the frame, render, flush, area, loop and helix_loop histograms
+plus busy/idle time since the previous dump. Everything else on the
+console (text reports, 0xB1 binlog records) is skipped.
+
+    python3 tools/perf_view.py /dev/ttyACM0            # request one dump (needs pyserial)
+    python3 tools/perf_view.py /dev/ttyACM0 --every 10 # one dump per 10 s window
+    python3 tools/perf_view.py capture.bin             # every dump in a capture
+"""
+import os
+import re
+import sys
+import time
+
+SYNC, TAG, CMD = 0xB2, ord("P"), b"p"
+PERF_H = os.path.join(os.path.dirname(__file__), "..", "src", "log", "perf.h")
+BAR = 40
+
+
+def load_hists(path=PERF_H):
+    """[(name, label, unit)] in id order, parsed from the X-macro list."""
+    text = open(path, encoding="utf-8").read()
+    return re.findall(r'X\((\w+),\s*"([^"]*)",\s*"([^"]*)"\)', text)
+
+
+class Reader:
+    def __init__(self, buf):
+        self.buf, self.at = buf, 0
+
+    def byte(self):
+        self.at += 1
+        return self.buf[self.at - 1]
+
+    def varint(self):
+        v, shift = 0, 0
+        while True:
+            b = self.byte()
+            v |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                return v
+
+
+def bin_top(b, sub_bits, bins):
+    """Largest value in bucket b (log_hist.cpp)."""
+    sub = 1 << sub_bits
+    if b < sub:
+        return b
+    if b >= bins - 1:
+        return float("inf")
+    nxt = b + 1
+    e = nxt // sub + sub_bits - 1
+    return ((sub + nxt % sub) << (e - sub_bits)) - 1
+
+
+def percentile(h, pct, sub_bits, bins):
+    if not h["n"]:
+        return 0
+    rank = max(1, -(-h["n"] * pct // 100))
+    seen = 0
+    for b, c in sorted(h["bins"].items()):
+        seen += c
+        if seen >= rank:
+            return min(bin_top(b, sub_bits, bins), h["max"])
+    return h["max"]
+
+
+def parse(payload):
+    r = Reader(payload)
+    d = {"version": r.byte(), "sub_bits": r.byte(), "bins": r.byte()}
+    n_hists = r.byte()
+    d["window_ms"], d["passes"] = r.varint(), r.varint()
+    d["busy_us"], d["idle_us"] = r.varint(), r.varint()
+    d["hists"] = []
+    for _ in range(n_hists):
+        h = {"id": r.byte(), "n": r.varint(), "max": r.varint(), "bins": {}}
+        for _ in range(r.byte()):
+            b = r.byte()
+            h["bins"][b] = r.varint()
+        d["hists"].append(h)
+    return d
+
+
+def frames(data):
+    """Yield (payload) for every valid frame in a byte string."""
+    i = 0
+    while True:
+        i = data.find(bytes([SYNC, TAG]), i)
+        if i < 0 or len(data) < i + 4:
+            return
+        n = data[i + 2] | data[i + 3] << 8
+        end = i + 4 + n
+        if len(data) < end + 1:
+            return
+        payload = data[i + 4:end]
+        if sum(payload) & 0xFF == data[end]:
+            yield payload
+            i = end + 1
+        else:
+            i += 1      # a 0xB2 inside something else
+
+
+def show(d, names, out=sys.stdout):
+    total = d["busy_us"] + d["idle_us"]
+    idle = 100.0 * d["idle_us"] / total if total else 0.0
+    out.write("window %.1f s  passes=%d  busy=%.1f ms  idle=%.1f%%\n"
+              % (d["window_ms"] / 1000.0, d["passes"], d["busy_us"] / 1000.0, idle))
+
+    sub_bits, bins = d["sub_bits"], d["bins"]
+    for h in d["hists"]:
+        name, label, unit = names[h["id"]] if h["id"] < len(names) else ("?", "#%d" % h["id"], "")
+        if not h["n"]:
+            out.write("  %-7s (none)\n" % label)
+            continue
+        out.write("  %-7s n=%-7d p50=%-7s p90=%-7s p99=%-7s max=%d %s\n"
+                  % (label, h["n"],
+                     percentile(h, 50, sub_bits, bins), percentile(h, 90, sub_bits, bins),
+                     percentile(h, 99, sub_bits, bins), h["max"], unit))
+        peak = max(h["bins"].values())
+        for b, c in sorted(h["bins"].items()):
+            top = bin_top(b, sub_bits, bins)
+            edge = "inf" if top == float("inf") else "%d" % top
+            out.write("    ≤%9s %s %d\n" % (edge, "#" * max(1, c * BAR // peak), c))
+    out.flush()
+
+
+def live(port, every, names):
+    import serial                               # pyserial, only for live ports
+    s = serial.Serial(port, 115200, timeout=0.1)
+    try:
+        while True:
+            s.reset_input_buffer()
+            s.write(CMD)
+            buf, t0, got = b"", time.time(), None
+            while got is None:
+                buf += s.read(4096)
+                got = next(frames(buf), None)
+                if got is None and time.time() - t0 > 2.0:
+                    # The governor may have the chip in light sleep
+                    print("[perf_view] no answer yet (asleep? turn the knob)", file=sys.stderr)
+                    s.write(CMD)
+                    t0 = time.time()
+            show(parse(got), names)
+            if not every:
+                return
+            time.sleep(every)
+    except KeyboardInterrupt:
+        pass
+
+
+def main():
+    args = sys.argv[1:]
+    every = 0.0
+    if "--every" in args:
+        i = args.index("--every")
+        every = float(args[i + 1])
+        del args[i:i + 2]
+    src = args[0] if args else "-"
+    names = [(n, label, unit) for n, label, unit in load_hists()]
+
+    if src.startswith("/dev/"):
+        live(src, every, names)
+        return
+
+    data = sys.stdin.buffer.read() if src == "-" else open(src, "rb").read()
+    n = 0
+    for payload in frames(data):
+        show(parse(payload), names)
+        n += 1
+    if not n:
+        print("[perf_view] no perf frames found", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()